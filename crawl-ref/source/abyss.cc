@@ -71,6 +71,22 @@ static sample_queue abyss_sample_queue;
 static vector<dungeon_feature_type> abyssal_features;
 static list<monster*> displaced_monsters;
 
+// Cells whose scheduled morph fell due while they were too far from the
+// player to be seen. They keep their old (valid) terrain and get
+// rematerialised from the noise stack when the player comes near, instead
+// of being resampled at every changepoint. Like the sample queue this is
+// transient state: it's empty after a reload, when the whole area is
+// regenerated anyway.
+static map_bitmask _abyss_deferred_morph;
+
+// Everything within ABYSS_AREA_SHIFT_RADIUS of the player survives an area
+// shift in place, so morphs may only be deferred outside a slightly larger
+// window; the margin covers player movement between morph and shift.
+static bool _in_abyss_morph_window(const coord_def &p)
+{
+    return grid_distance(p, you.pos()) <= ABYSS_AREA_SHIFT_RADIUS + 2;
+}
+
 static void abyss_area_shift();
 static void _push_items();
 static void _push_displaced_monster(monster* mon);
@@ -1255,8 +1271,18 @@ static void _abyss_apply_terrain(const map_bitmask &abyss_genlevel_mask,
         {
             ++ii;
             coord_def p = abyss_sample_queue.top().coord();
-            _update_abyss_terrain(p, abyss_genlevel_mask, morph);
             abyss_sample_queue.pop();
+
+            // Far cells will be regenerated before anyone can see them;
+            // freeze them instead of resampling the whole noise stack.
+            const coord_def rp = p - abyssal_state.major_coord;
+            if (in_bounds(rp) && !_in_abyss_morph_window(rp))
+            {
+                _abyss_deferred_morph.set(rp);
+                continue;
+            }
+
+            _update_abyss_terrain(p, abyss_genlevel_mask, morph);
         }
 /*
         if (ii)
@@ -1272,7 +1298,17 @@ static void _abyss_apply_terrain(const map_bitmask &abyss_genlevel_mask,
         const coord_def abyss_coord = p + abyssal_state.major_coord;
         bool turned_to_floor = map_masked(p, MMT_TURNED_TO_FLOOR);
         if (used_queue && !turned_to_floor)
+        {
+            // Catch up cells whose morph was deferred while they were out
+            // of range; resampling gives their current state directly.
+            if (_abyss_deferred_morph(p) && _in_abyss_morph_window(p))
+            {
+                _abyss_deferred_morph.set(p, false);
+                _update_abyss_terrain(abyss_coord, abyss_genlevel_mask,
+                                      morph);
+            }
             continue;
+        }
 
         if (turned_to_floor && (now || x_chance_in_y(delta, 50))
             || !turned_to_floor && !used_queue)
@@ -1391,6 +1427,7 @@ static void _initialize_abyss_state()
     abyssal_state.destroy_all_terrain = false;
     abyssal_state.level = _get_random_level();
     abyss_sample_queue = sample_queue(ProceduralSamplePQCompare());
+    _abyss_deferred_morph.reset();
 }
 
 void set_abyss_state(coord_def coord, uint32_t depth)
@@ -1401,6 +1438,7 @@ void set_abyss_state(coord_def coord, uint32_t depth)
     abyssal_state.phase = 0.0;
     abyssal_state.destroy_all_terrain = true;
     abyss_sample_queue = sample_queue(ProceduralSamplePQCompare());
+    _abyss_deferred_morph.reset();
     you.moveto(ABYSS_CENTRE);
     map_bitmask abyss_genlevel_mask(true);
     _abyss_apply_terrain(abyss_genlevel_mask, true, true);
@@ -1425,6 +1463,10 @@ static void abyss_area_shift()
             _abyss_shift_level_contents_around_player(
                 ABYSS_AREA_SHIFT_RADIUS, ABYSS_CENTRE, abyss_genlevel_mask);
             _generate_area(abyss_genlevel_mask);
+
+            // Deferred cells were all outside the preserved area and have
+            // just been regenerated from scratch.
+            _abyss_deferred_morph.reset();
         }
         forget_map(true);
 
@@ -610,12 +610,7 @@ static int _acquirement_staff_subtype(bool /*divine*/, int & /*quantity*/)
     // Try to pick an enhancer staff matching the player's best skill.
     skill_type best_spell_skill = best_skill(SK_SPELLCASTING, SK_EVOCATIONS);
     bool found_enhancer = false;
-    int result = 0;
-    do
-    {
-        result = random2(NUM_STAVES);
-    }
-    while (item_type_removed(OBJ_STAVES, result));
+    int result = random_subtype_not_removed(OBJ_STAVES, 0, NUM_STAVES - 1);
 
     switch (best_spell_skill)
     {
@@ -650,10 +645,9 @@ static int _acquirement_rod_subtype(bool /*divine*/, int & /*quantity*/)
     int result;
     do
     {
-        result = random2(NUM_RODS);
+        result = random_subtype_not_removed(OBJ_RODS, 0, NUM_RODS - 1);
     }
-    while (player_mutation_level(MUT_NO_LOVE) && result == ROD_SHADOWS
-           || item_type_removed(OBJ_RODS, result));
+    while (player_mutation_level(MUT_NO_LOVE) && result == ROD_SHADOWS);
     return result;
 }
 
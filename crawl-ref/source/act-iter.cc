@@ -2,12 +2,49 @@
 
 #include "act-iter.h"
 
+#include <algorithm>
+
 #include "env.h"
 #include "losglobal.h"
+#include "mon-place.h"
+
+// Collect candidate monsters by scanning mgrd over the LOS bounding box
+// around the centre instead of filtering all of menv: anything
+// cell_see_cell() can accept lies within LOS_RADIUS, and monster-dense
+// fights put far fewer monsters in that box than there are menv slots.
+// LOS_NONE imposes no range limit, so it keeps the full-list behaviour.
+// Sorted by mindex so the visit order matches the old full scan.
+static void _gather_near(vector<short> &targets, const coord_def &c,
+                         los_type los)
+{
+    if (los == LOS_NONE)
+    {
+        for (short m = 0; m < MAX_MONSTERS; ++m)
+            if (menv[m].alive())
+                targets.push_back(m);
+        return;
+    }
+
+    const int x1 = max(int(X_BOUND_1), c.x - LOS_RADIUS);
+    const int x2 = min(int(X_BOUND_2), c.x + LOS_RADIUS);
+    const int y1 = max(int(Y_BOUND_1), c.y - LOS_RADIUS);
+    const int y2 = min(int(Y_BOUND_2), c.y + LOS_RADIUS);
+
+    for (int x = x1; x <= x2; ++x)
+        for (int y = y1; y <= y2; ++y)
+        {
+            const int m = mgrd[x][y];
+            if (m != NON_MONSTER)
+                targets.push_back(m);
+        }
+
+    sort(targets.begin(), targets.end());
+}
 
 actor_near_iterator::actor_near_iterator(coord_def c, los_type los)
     : center(c), _los(los), viewer(nullptr), i(-1)
 {
+    _gather_near(targets, center, _los);
     if (!valid(&you))
         advance();
 }
@@ -15,6 +52,7 @@ actor_near_iterator::actor_near_iterator(coord_def c, los_type los)
 actor_near_iterator::actor_near_iterator(const actor* a, los_type los)
     : center(a->pos()), _los(los), viewer(a), i(-1)
 {
+    _gather_near(targets, center, _los);
     if (!valid(&you))
         advance();
 }
@@ -28,8 +66,8 @@ actor* actor_near_iterator::operator*() const
 {
     if (i == -1)
         return &you;
-    else if (i < MAX_MONSTERS)
-        return &menv[i];
+    else if (i < (int)targets.size())
+        return &menv[targets[i]];
     else
         return nullptr;
 }
@@ -64,7 +102,7 @@ bool actor_near_iterator::valid(const actor* a) const
 void actor_near_iterator::advance()
 {
     do
-         if (++i >= MAX_MONSTERS)
+         if (++i >= (int)targets.size())
              return;
     while (!valid(**this));
 }
@@ -74,14 +112,16 @@ void actor_near_iterator::advance()
 monster_near_iterator::monster_near_iterator(coord_def c, los_type los)
     : center(c), _los(los), viewer(nullptr), i(0)
 {
-    if (!valid(&menv[0]))
+    _gather_near(targets, center, _los);
+    if (!valid(**this))
         advance();
 }
 
 monster_near_iterator::monster_near_iterator(const actor *a, los_type los)
     : center(a->pos()), _los(los), viewer(a), i(0)
 {
-    if (!valid(&menv[0]))
+    _gather_near(targets, center, _los);
+    if (!valid(**this))
         advance();
 }
 
@@ -92,8 +132,8 @@ monster_near_iterator::operator bool() const
 
 monster* monster_near_iterator::operator*() const
 {
-    if (i < MAX_MONSTERS)
-        return &menv[i];
+    if (i < (int)targets.size())
+        return &menv[targets[i]];
     else
         return nullptr;
 }
@@ -128,18 +168,23 @@ bool monster_near_iterator::valid(const monster* a) const
 void monster_near_iterator::advance()
 {
     do
-         if (++i >= MAX_MONSTERS)
+         if (++i >= (int)targets.size())
              return;
     while (!valid(**this));
 }
 
 //////////////////////////////////////////////////////////////////////////
 
+// Iteration stops at the live-slot watermark rather than MAX_MONSTERS:
+// no slot at or above it can hold a live monster (see mon-place.cc).
 monster_iterator::monster_iterator()
     : i(0)
 {
-    while (i < MAX_MONSTERS && !menv[i].alive())
+    const int watermark = monster_slot_watermark();
+    while (i < watermark && !menv[i].alive())
         i++;
+    if (i >= watermark)
+        i = MAX_MONSTERS;
 }
 
 monster_iterator::operator bool() const
@@ -162,9 +207,12 @@ monster* monster_iterator::operator->() const
 
 monster_iterator& monster_iterator::operator++()
 {
-    while (++i < MAX_MONSTERS)
+    const int watermark = monster_slot_watermark();
+    while (++i < watermark)
         if (menv[i].alive())
             break;
+    if (i >= watermark)
+        i = MAX_MONSTERS;
     return *this;
 }
 
@@ -177,8 +225,12 @@ monster_iterator monster_iterator::operator++(int)
 
 void monster_iterator::advance()
 {
+    const int watermark = monster_slot_watermark();
     do
-         if (++i >= MAX_MONSTERS)
+         if (++i >= watermark)
+         {
+             i = MAX_MONSTERS;
              return;
+         }
     while (!(*this)->alive());
 }
@@ -23,6 +23,9 @@ protected:
     los_type _los;
     const actor* viewer;
     int i;
+    // Candidate mindexes near center, gathered from mgrd at
+    // construction time; -1 stands for the player.
+    vector<short> targets;
 
     bool valid(const actor* a) const;
     void advance();
@@ -45,6 +48,9 @@ protected:
     los_type _los;
     const actor* viewer;
     int i;
+    // Candidate mindexes near center, gathered from mgrd at
+    // construction time.
+    vector<short> targets;
 
     bool valid(const monster* a) const;
     void advance();
@@ -34,7 +34,10 @@ bool player::see_cell(const coord_def &p) const
 
 bool actor::can_see(const actor &target) const
 {
-    return target.visible_to(this) && see_cell(target.pos());
+    // Check LOS first: it's a cached table lookup (losglobal.cc), while
+    // visible_to() re-derives invisibility, blindness and backlighting,
+    // and most queried pairs aren't in sight of each other at all.
+    return see_cell(target.pos()) && target.visible_to(this);
 }
 
 bool actor::see_cell_no_trans(const coord_def &p) const
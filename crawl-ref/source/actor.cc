@@ -155,6 +155,7 @@ void actor::set_position(const coord_def &c)
     position = c;
     los_actor_moved(this, oldpos);
     areas_actor_moved(this, oldpos);
+    invalidate_tension_cache();
 }
 
 bool actor::can_hibernate(bool holi_only, bool intrinsic_only) const
@@ -552,6 +553,9 @@ void actor::clear_far_constrictions()
 void actor::clear_constrictions_far_from(const coord_def &where)
 {
     clear_far_engulf();
+    if (!constricted_by && !constricting)
+        return;
+
     actor* const constrictor = actor_by_mid(constricted_by);
 
     if (!constrictor || !adjacent(where, constrictor->pos()))
@@ -632,7 +636,7 @@ bool actor::can_constrict(const actor* defender) const
 // Deal damage over time
 void actor::handle_constriction()
 {
-    if (is_sanctuary(pos()))
+    if (constricting && is_sanctuary(pos()))
         stop_constricting_all(true);
 
     // Constriction should have stopped the moment the actors became
@@ -58,19 +58,28 @@ struct area_centre
 typedef FixedArray<areaprops, GXM, GYM> propgrid_t;
 
 static vector<area_centre> _agrid_centres;
+// Sunlight cells flagged by the last rebuild; like _agrid_centres,
+// kept so the next rebuild can clear only what was actually set.
+static vector<coord_def> _agrid_sunlight;
 
 static propgrid_t _agrid;
 static bool _agrid_valid = false;
 static bool no_areas = false;
+// Union of every flag the last rebuild set anywhere on the level. Point
+// queries test it first, so e.g. silenced() with no silence source on
+// the level answers without loading the grid cell at all -- by far the
+// commonest case for most area types.
+static areaprops _agrid_props;
 
 static void _set_agrid_flag(const coord_def& p, areaprop f)
 {
     _agrid(p) |= f;
+    _agrid_props |= f;
 }
 
 static bool _check_agrid_flag(const coord_def& p, areaprop f)
 {
-    return bool(_agrid(p) & f);
+    return bool(_agrid_props & f) && bool(_agrid(p) & f);
 }
 
 void invalidate_agrid(bool recheck_new)
@@ -109,21 +118,46 @@ static void _actor_areas(actor *a)
         no_areas = false;
     }
 
-    if ((r = a->halo_radius()) >= 0)
+    // Halo and umbra share the same LOS mask; query the whole disc
+    // once instead of calling cell_see_cell() per cell per area.
+    if (a->halo_radius() >= 0 || a->umbra_radius() >= 0)
     {
-        _agrid_centres.emplace_back(AREA_HALO, a->pos(), r);
+        los_grid mask;
+        fill_los_mask(a->pos(), LOS_DEFAULT, mask);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::HALO);
-        no_areas = false;
+        if ((r = a->halo_radius()) >= 0)
+        {
+            _agrid_centres.emplace_back(AREA_HALO, a->pos(), r);
+
+            for (radius_iterator ri(a->pos(), r, C_SQUARE); ri; ++ri)
+                if (mask(*ri - a->pos()))
+                    _set_agrid_flag(*ri, areaprop::HALO);
+            no_areas = false;
+        }
+
+        if ((r = a->umbra_radius()) >= 0)
+        {
+            _agrid_centres.emplace_back(AREA_UMBRA, a->pos(), r);
+
+            for (radius_iterator ri(a->pos(), r, C_SQUARE); ri; ++ri)
+                if (mask(*ri - a->pos()))
+                    _set_agrid_flag(*ri, areaprop::UMBRA);
+            no_areas = false;
+        }
     }
 
     if ((r = a->liquefying_radius()) >= 0)
     {
         _agrid_centres.emplace_back(AREA_LIQUID, a->pos(), r);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_SOLID); ri; ++ri)
+        los_grid mask;
+        fill_los_mask(a->pos(), LOS_SOLID, mask);
+
+        for (radius_iterator ri(a->pos(), r, C_SQUARE); ri; ++ri)
         {
+            if (!mask(*ri - a->pos()))
+                continue;
+
             dungeon_feature_type f = grd(*ri);
 
             _set_agrid_flag(*ri, areaprop::LIQUID);
@@ -134,22 +168,17 @@ static void _actor_areas(actor *a)
         no_areas = false;
     }
 
-    if ((r = a->umbra_radius()) >= 0)
-    {
-        _agrid_centres.emplace_back(AREA_UMBRA, a->pos(), r);
-
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_DEFAULT); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::UMBRA);
-        no_areas = false;
-    }
-
 #if TAG_MAJOR_VERSION == 34
     if ((r = a->heat_radius()) >= 0)
     {
         _agrid_centres.emplace_back(AREA_HOT, a->pos(), r);
 
-        for (radius_iterator ri(a->pos(), r, C_SQUARE, LOS_NO_TRANS); ri; ++ri)
-            _set_agrid_flag(*ri, areaprop::HOT);
+        los_grid mask;
+        fill_los_mask(a->pos(), LOS_NO_TRANS, mask);
+
+        for (radius_iterator ri(a->pos(), r, C_SQUARE); ri; ++ri)
+            if (mask(*ri - a->pos()))
+                _set_agrid_flag(*ri, areaprop::HOT);
         no_areas = false;
     }
 #endif
@@ -169,8 +198,17 @@ static void _update_agrid()
         return;
     }
 
-    _agrid.init(areaprops());
+    // Every flag write below registers the disc it falls into, so
+    // clearing the regions recorded by the last rebuild leaves the
+    // grid clean without wiping all of GXM*GYM.
+    for (const area_centre &a : _agrid_centres)
+        for (radius_iterator ri(a.centre, a.radius, C_SQUARE); ri; ++ri)
+            _agrid(*ri) = areaprops();
+    for (const coord_def &p : _agrid_sunlight)
+        _agrid(p) = areaprops();
     _agrid_centres.clear();
+    _agrid_sunlight.clear();
+    _agrid_props = areaprops();
 
     no_areas = true;
 
@@ -187,36 +225,45 @@ static void _update_agrid()
         no_areas = false;
     }
 
-    if (you.duration[DUR_QUAD_DAMAGE])
+    if (you.duration[DUR_QUAD_DAMAGE] || you.duration[DUR_DISJUNCTION])
     {
-        const int r = 2;
-        _agrid_centres.emplace_back(AREA_QUAD, you.pos(), r);
-        for (radius_iterator ri(you.pos(), r, C_SQUARE);
-             ri; ++ri)
+        los_grid mask;
+        fill_los_mask(you.pos(), LOS_DEFAULT, mask);
+
+        if (you.duration[DUR_QUAD_DAMAGE])
         {
-            if (cell_see_cell(you.pos(), *ri, LOS_DEFAULT))
-                _set_agrid_flag(*ri, areaprop::QUAD);
+            const int r = 2;
+            _agrid_centres.emplace_back(AREA_QUAD, you.pos(), r);
+            for (radius_iterator ri(you.pos(), r, C_SQUARE);
+                 ri; ++ri)
+            {
+                if (mask(*ri - you.pos()))
+                    _set_agrid_flag(*ri, areaprop::QUAD);
+            }
+            no_areas = false;
         }
-        no_areas = false;
-    }
 
-    if (you.duration[DUR_DISJUNCTION])
-    {
-        const int r = 4;
-        _agrid_centres.emplace_back(AREA_DISJUNCTION, you.pos(), r);
-        for (radius_iterator ri(you.pos(), r, C_SQUARE);
-             ri; ++ri)
+        if (you.duration[DUR_DISJUNCTION])
         {
-            if (cell_see_cell(you.pos(), *ri, LOS_DEFAULT))
-                _set_agrid_flag(*ri, areaprop::DISJUNCTION);
+            const int r = 4;
+            _agrid_centres.emplace_back(AREA_DISJUNCTION, you.pos(), r);
+            for (radius_iterator ri(you.pos(), r, C_SQUARE);
+                 ri; ++ri)
+            {
+                if (mask(*ri - you.pos()))
+                    _set_agrid_flag(*ri, areaprop::DISJUNCTION);
+            }
+            no_areas = false;
         }
-        no_areas = false;
     }
 
     if (!env.sunlight.empty())
     {
         for (const auto &entry : env.sunlight)
+        {
             _set_agrid_flag(entry.first, areaprop::HALO);
+            _agrid_sunlight.push_back(entry.first);
+        }
         no_areas = false;
     }
 
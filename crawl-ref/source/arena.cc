@@ -118,6 +118,8 @@ namespace arena
 
     static bool miscasts            = false;
 
+    static bool headless            = false;
+
     static int  summon_throttle     = INT_MAX;
 
     static vector<monster_type> uniques_list;
@@ -325,6 +327,7 @@ namespace arena
         real_summons    =  strip_tag(spec, "real_summons");
         move_summons    =  strip_tag(spec, "move_summons");
         miscasts        =  strip_tag(spec, "miscasts");
+        headless        =  strip_tag(spec, "headless");
         respawn         =  strip_tag(spec, "respawn");
         move_respawns   =  strip_tag(spec, "move_respawns");
         summon_throttle = strip_number_tag(spec, "summon_throttle:");
@@ -789,7 +792,10 @@ namespace arena
             cursor_control coff(false);
             while (fight_is_on())
             {
-                if (kbhit())
+                // In headless mode the screen isn't redrawn between turns
+                // and turns go by very quickly, so polling the keyboard on
+                // the book-keeping cadence is plenty to stay cancellable.
+                if ((!headless || turns % 100 == 0) && kbhit())
                 {
                     const int ch = getchm();
                     handle_keypress(ch);
@@ -807,7 +813,8 @@ namespace arena
                 if ((turns++ % 100) == 0)
                     count_foes();
 
-                viewwindow();
+                if (!headless)
+                    viewwindow();
                 you.time_taken = 10;
                 // Make sure we don't starve.
                 you.hunger = HUNGER_MAXIMUM;
@@ -817,7 +824,8 @@ namespace arena
                 do_respawn(faction_a);
                 do_respawn(faction_b);
                 balance_spawners();
-                delay(Options.view_delay);
+                if (!headless)
+                    delay(Options.view_delay);
                 clear_messages();
                 dump_messages();
                 ASSERT(you.pet_target == MHITNOT);
@@ -999,7 +1007,7 @@ namespace arena
             }
             do_fight();
 
-            if (trials_done < total_trials)
+            if (!headless && trials_done < total_trials)
                 delay(Options.view_delay * 5);
         }
         while (!contest_cancelled && trials_done < total_trials);
@@ -1011,7 +1019,8 @@ namespace arena
                  faction_b.desc.c_str(), trials_done - team_a_wins - ties,
                  ties);
         }
-        delay(Options.view_delay * 5);
+        if (!headless)
+            delay(Options.view_delay * 5);
 
         write_results();
     }
@@ -60,6 +60,7 @@ attack::attack(actor *attk, actor *defn, actor *blame)
       attacker_armour_tohit_penalty(0), attacker_shield_tohit_penalty(0),
       defender_shield(nullptr), miscast_level(-1), miscast_type(SPTYP_NONE),
       miscast_target(nullptr), fake_chaos_attack(false), simu(false),
+      slay_bonus_cache(), slay_bonus_cached(),
       aux_source(""), kill_type(KILLED_BY_MONSTER)
 {
     // No effective code should execute, we'll call init_attack again from
@@ -140,6 +141,20 @@ bool attack::handle_phase_end()
  *
  * @param random If false, calculate average to-hit deterministically.
  */
+// slaying_bonus() scans rings, artefact properties and mutations, and a
+// single attack asks for it several times: to-hit, damage, and again for
+// each aux. Nothing it reads can change between those steps, so compute
+// it once per attack object (per ranged flag - the two differ).
+int attack::attacker_slaying_bonus(bool ranged)
+{
+    if (!slay_bonus_cached[ranged])
+    {
+        slay_bonus_cache[ranged] = slaying_bonus(ranged);
+        slay_bonus_cached[ranged] = true;
+    }
+    return slay_bonus_cache[ranged];
+}
+
 int attack::calc_to_hit(bool random)
 {
     int mhit = attacker->is_player() ?
@@ -196,7 +211,7 @@ int attack::calc_to_hit(bool random)
         }
 
         // slaying bonus
-        mhit += slaying_bonus(wpn_skill == SK_THROWING
+        mhit += attacker_slaying_bonus(wpn_skill == SK_THROWING
                               || (weapon && is_range_weapon(*weapon)
                                          && using_weapon()));
 
@@ -1271,9 +1286,9 @@ int attack::player_apply_slaying_bonuses(int damage, bool aux)
         damage_plus = get_weapon_plus();
     if (you.duration[DUR_CORROSION])
         damage_plus -= 4 * you.props["corrosion_amount"].get_int();
-    damage_plus += slaying_bonus(!weapon && wpn_skill == SK_THROWING
-                                 || (weapon && is_range_weapon(*weapon)
-                                            && using_weapon()));
+    damage_plus += attacker_slaying_bonus(!weapon && wpn_skill == SK_THROWING
+                                          || (weapon && is_range_weapon(*weapon)
+                                                     && using_weapon()));
 
     damage += (damage_plus > -1) ? (random2(1 + damage_plus))
                                  : (-random2(1 - damage_plus));
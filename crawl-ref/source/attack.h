@@ -92,6 +92,10 @@ public:
 
     bool simu;
 
+    // See attacker_slaying_bonus(), indexed by the ranged flag.
+    int       slay_bonus_cache[2];
+    bool      slay_bonus_cached[2];
+
 // Public Methods
 public:
     attack(actor *attk, actor *defn, actor *blame = 0);
@@ -124,6 +128,9 @@ protected:
     virtual bool handle_phase_end();
 
     /* Combat Calculations */
+    // Memoized slaying_bonus(): the equipment scan behind it can't
+    // change between the to-hit, damage and aux steps of one attack.
+    int attacker_slaying_bonus(bool ranged);
     virtual bool using_weapon() = 0;
     virtual int weapon_damage() = 0;
     virtual int get_weapon_plus();
@@ -30,6 +30,8 @@
 // temporarily.
 void mons_att_changed(monster* mon)
 {
+    invalidate_tension_cache();
+
     const mon_attitude_type att = mon->temp_attitude();
     const monster_type mc = mons_base_type(*mon);
 
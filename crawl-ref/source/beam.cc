@@ -2297,7 +2297,7 @@ void create_feat_splash(coord_def center,
 }
 
 bool imb_can_splash(coord_def origin, coord_def center,
-                    vector<coord_def> path_taken, coord_def target)
+                    const vector<coord_def> &path_taken, coord_def target)
 {
     // Don't go back along the path of the beam (the explosion doesn't
     // reverse direction). We do this to avoid hitting the caster and
@@ -6034,6 +6034,27 @@ int explosion_noise(int rad)
 }
 
 #define MAX_EXPLOSION_RADIUS 9
+
+// Memo for the last explosion footprint flood. The flood reads terrain,
+// sanctuary, the caster's position and the beam's wall-affecting rules,
+// so the key covers exactly those inputs; the LOS epoch folds in every
+// terrain, door and opaque-cloud change on the level. The common hits
+// are a tracer followed by the real cast in the same turn, and spammed
+// identical casts at the same spot across turns.
+static struct
+{
+    bool valid = false;
+    coord_def origin, caster;
+    int r;
+    beam_type flavour;
+    spell_type origin_spell;
+    int damage_num;
+    unsigned los_epoch;
+    coord_def sanct_pos;
+    int sanct_time;
+    explosion_map map;
+} _explosion_memo;
+
 // Returns true if we saw something happening.
 bool bolt::explode(bool show_more, bool hole_in_the_middle)
 {
@@ -6097,10 +6118,43 @@ bool bolt::explode(bool show_more, bool hole_in_the_middle)
             mprf(MSGCH_SOUND, "%s", explode_noise_msg.c_str());
     }
 
-    // Run DFS to determine which cells are influenced
+    // Run DFS to determine which cells are influenced, unless the memo
+    // already holds this exact footprint. The map is copied out of the
+    // memo because affecting cells can kill a spore and nest another
+    // explosion inside this one, which would overwrite it.
+    const actor *caster = actor_by_mid(source_id);
+    const coord_def caster_pos = caster ? caster->pos() : you.pos();
     explosion_map exp_map;
-    exp_map.init(INT_MAX);
-    determine_affected_cells(exp_map, coord_def(), 0, r, true, true);
+    if (_explosion_memo.valid
+        && _explosion_memo.origin == pos()
+        && _explosion_memo.caster == caster_pos
+        && _explosion_memo.r == r
+        && _explosion_memo.flavour == flavour
+        && _explosion_memo.origin_spell == origin_spell
+        && _explosion_memo.damage_num == damage.num
+        && _explosion_memo.los_epoch == los_epoch()
+        && _explosion_memo.sanct_pos == env.sanctuary_pos
+        && _explosion_memo.sanct_time == env.sanctuary_time)
+    {
+        exp_map = _explosion_memo.map;
+    }
+    else
+    {
+        exp_map.init(INT_MAX);
+        determine_affected_cells(exp_map, coord_def(), 0, r, true, true);
+
+        _explosion_memo.valid        = true;
+        _explosion_memo.origin       = pos();
+        _explosion_memo.caster       = caster_pos;
+        _explosion_memo.r            = r;
+        _explosion_memo.flavour      = flavour;
+        _explosion_memo.origin_spell = origin_spell;
+        _explosion_memo.damage_num   = damage.num;
+        _explosion_memo.los_epoch    = los_epoch();
+        _explosion_memo.sanct_pos    = env.sanctuary_pos;
+        _explosion_memo.sanct_time   = env.sanctuary_time;
+        _explosion_memo.map          = exp_map;
+    }
 
     // We get a bit fancy, drawing all radius 0 effects, then radius
     // 1, radius 2, etc. It looks a bit better that way.
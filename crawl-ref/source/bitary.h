@@ -56,10 +56,12 @@ public:
 
     inline bool get(unsigned int i) const
     {
-#ifdef ASSERTS
+#ifdef HOT_ASSERTS
         // printed as signed, as in FixedVector
         if (i >= SIZE)
             die("bit vector range error: %d / %u", (int)i, SIZE);
+#else
+        ASSERT_HOT(i < SIZE);
 #endif
         return data[i];
     }
@@ -71,9 +73,11 @@ public:
 
     inline void set(unsigned int i, bool value = true)
     {
-#ifdef ASSERTS
+#ifdef HOT_ASSERTS
         if (i >= SIZE)
             die("bit vector range error: %d / %u", (int)i, SIZE);
+#else
+        ASSERT_HOT(i < SIZE);
 #endif
         data[i] = value;
     }
@@ -83,6 +87,32 @@ public:
         return data.count();
     }
 
+    // Index of the first set bit, or SIZE if there is none.
+    inline unsigned int first_set() const
+    {
+#ifdef __GNUC__
+        return data._Find_first();
+#else
+        for (unsigned int i = 0; i < SIZE; ++i)
+            if (data[i])
+                return i;
+        return SIZE;
+#endif
+    }
+
+    // Index of the first set bit after i, or SIZE if there is none.
+    inline unsigned int next_set(unsigned int i) const
+    {
+#ifdef __GNUC__
+        return data._Find_next(i);
+#else
+        while (++i < SIZE)
+            if (data[i])
+                return i;
+        return SIZE;
+#endif
+    }
+
     inline bool any() const
     {
         return data.any();
@@ -137,10 +167,12 @@ public:
 
     inline bool get(int x, int y) const
     {
-#ifdef ASSERTS
+#ifdef HOT_ASSERTS
         // printed as signed, as in FixedArray
         if (x < 0 || y < 0 || x >= (int)SIZEX || y >= (int)SIZEY)
             die("bit array range error: %d,%d / %u,%u", x, y, SIZEX, SIZEY);
+#else
+        ASSERT_HOT(x >= 0 && y >= 0 && x < (int)SIZEX && y < (int)SIZEY);
 #endif
         unsigned int i = y * SIZEX + x;
         return data[i];
@@ -163,9 +195,11 @@ public:
 
     inline void set(int x, int y, bool value = true)
     {
-#ifdef ASSERTS
+#ifdef HOT_ASSERTS
         if (x < 0 || y < 0 || x >= (int)SIZEX || y >= (int)SIZEY)
             die("bit array range error: %d,%d / %u,%u", x, y, SIZEX, SIZEY);
+#else
+        ASSERT_HOT(x >= 0 && y >= 0 && x < (int)SIZEX && y < (int)SIZEY);
 #endif
         unsigned int i = y * SIZEX + x;
         data[i] = value;
@@ -187,6 +221,17 @@ public:
         data &= x.data;
         return *this;
     }
+
+    // Word-level bulk queries, as on FixedBitVector.
+    inline unsigned int count() const
+    {
+        return data.count();
+    }
+
+    inline bool any() const
+    {
+        return data.any();
+    }
 };
 
 #endif
@@ -195,20 +195,31 @@ bool is_connected_branch(level_id place)
 
 branch_type branch_by_abbrevname(const string &branch, branch_type err)
 {
-    for (branch_iterator it; it; ++it)
-        if (it->abbrevname && it->abbrevname == branch)
-            return it->id;
+    // Built once from branches[]: vault depth specs and monster speech
+    // keys parse branch abbreviations often enough that the linear
+    // string scan was measurable during map loading.
+    static map<string, branch_type> abbrev_index;
+    if (abbrev_index.empty())
+    {
+        for (branch_iterator it; it; ++it)
+            if (it->abbrevname)
+                abbrev_index[it->abbrevname] = it->id;
+    }
 
-    return err;
+    return lookup(abbrev_index, branch, err);
 }
 
 branch_type branch_by_shortname(const string &branch)
 {
-    for (branch_iterator it; it; ++it)
-        if (it->shortname && it->shortname == branch)
-            return it->id;
+    static map<string, branch_type> shortname_index;
+    if (shortname_index.empty())
+    {
+        for (branch_iterator it; it; ++it)
+            if (it->shortname)
+                shortname_index[it->shortname] = it->id;
+    }
 
-    return NUM_BRANCHES;
+    return lookup(shortname_index, branch, NUM_BRANCHES);
 }
 
 int current_level_ambient_noise()
@@ -36,9 +36,35 @@
 #include "tiledef-main.h"
 #include "unwind.h"
 
+// O(1) position -> cloud lookup. std::map nodes are pointer-stable
+// until erased, so the grid can point straight into env.cloud; it's
+// kept in sync by the insertion/deletion choke points in this file and
+// rebuilt by rebuild_cloud_index() after bulk changes (level load,
+// direct env.cloud wipes). Opacity checks call cloud_at() for every
+// cell of every LOS recalculation, which is what makes the tree lookup
+// worth bypassing.
+static FixedArray<cloud_struct*, GXM, GYM> _cloud_index;
+
+void rebuild_cloud_index()
+{
+    _cloud_index.init(nullptr);
+    for (auto& entry : env.cloud)
+        _cloud_index(entry.first) = &entry.second;
+}
+
+// Insert-or-fetch the cloud at p, keeping the index pointed at it.
+static cloud_struct &_cloud_ref(const coord_def &p)
+{
+    cloud_struct &c = env.cloud[p];
+    _cloud_index(p) = &c;
+    return c;
+}
+
 cloud_struct* cloud_at(coord_def pos)
 {
-    return map_find(env.cloud, pos);
+    if (!map_bounds(pos))
+        return nullptr;
+    return _cloud_index(pos);
 }
 
 /// damage = base + random2avg(random, random/15 + 1)
@@ -385,9 +411,10 @@ static int _spread_cloud(const cloud_struct &cloud)
         if (newdecay >= cloud.decay)
             newdecay = cloud.decay - 1;
 
-        env.cloud[*ai] = cloud;
-        env.cloud[*ai].pos = *ai;
-        env.cloud[*ai].decay = newdecay;
+        cloud_struct &newc = _cloud_ref(*ai);
+        newc = cloud;
+        newc.pos = *ai;
+        newc.decay = newdecay;
 
         extra_decay += 8;
     }
@@ -411,10 +438,11 @@ static void _spread_fire(const cloud_struct &cloud)
         // burning trees produce flames all around
         if (!cell_is_solid(*ai) && make_flames)
         {
-            env.cloud[*ai] = cloud;
-            env.cloud[*ai].type = CLOUD_FIRE;
-            env.cloud[*ai].pos = *ai;
-            env.cloud[*ai].decay = cloud.decay / 2 + 1;
+            cloud_struct &newc = _cloud_ref(*ai);
+            newc = cloud;
+            newc.type = CLOUD_FIRE;
+            newc.pos = *ai;
+            newc.decay = cloud.decay / 2 + 1;
         }
 
         // forest fire doesn't spread in all directions at once,
@@ -428,9 +456,10 @@ static void _spread_fire(const cloud_struct &cloud)
         if (you.see_cell(*ai))
             mpr("The forest fire spreads!");
         destroy_wall(*ai);
-        env.cloud[*ai] = cloud;
-        env.cloud[*ai].pos = *ai;
-        env.cloud[*ai].decay = random2(30) + 25;
+        cloud_struct &newc = _cloud_ref(*ai);
+        newc = cloud;
+        newc.pos = *ai;
+        newc.decay = random2(30) + 25;
         if (cloud.whose == KC_YOU)
         {
             did_god_conduct(DID_KILL_PLANT, 1);
@@ -447,6 +476,13 @@ static void _cloud_interacts_with_terrain(const cloud_struct &cloud)
     if (cloud.type != CLOUD_FIRE && cloud.type != CLOUD_FOREST_FIRE)
         return;
 
+    // Only water steams; skip the neighbour scan entirely on dry
+    // levels, where firestorms otherwise pay it for every cloud every
+    // turn. The flag is conservative: it's set whenever watery terrain
+    // might exist and only cleared on level change.
+    if (!(env.level_state & LSTATE_WATERY))
+        return;
+
     for (adjacent_iterator ai(cloud.pos); ai; ++ai)
     {
         const coord_def p(*ai);
@@ -456,9 +492,9 @@ static void _cloud_interacts_with_terrain(const cloud_struct &cloud)
             && !cloud_at(p)
             && one_chance_in(7))
         {
-            env.cloud[p] = cloud_struct(p, CLOUD_STEAM, cloud.decay / 2 + 1,
-                                        22, cloud.whose, cloud.killer,
-                                        cloud.source, -1);
+            _cloud_ref(p) = cloud_struct(p, CLOUD_STEAM, cloud.decay / 2 + 1,
+                                         22, cloud.whose, cloud.killer,
+                                         cloud.source, -1);
         }
     }
 }
@@ -647,6 +683,7 @@ void delete_cloud(coord_def p)
         return;
     const cloud_type type = cloud_at(p)->type;
     env.cloud.erase(p);
+    _cloud_index(p) = nullptr;
     if (type == CLOUD_RAIN)
         _maybe_leave_water(p);
     _los_cloud_changed(p, type);
@@ -668,15 +705,17 @@ void delete_all_clouds()
 // that clouds get moved along with the rest of the map.
 void move_cloud(coord_def src, coord_def newpos)
 {
-    if (!cloud_at(src))
+    if (!cloud_at(src) || src == newpos)
         return;
     ASSERT(!cell_is_solid(newpos));
 
-    env.cloud[newpos] = env.cloud[src];
+    cloud_struct &newc = _cloud_ref(newpos);
+    newc = env.cloud[src];
     env.cloud.erase(src);
-    env.cloud[newpos].pos = newpos;
-    _los_cloud_changed(src, env.cloud[newpos].type);
-    _los_cloud_changed(newpos, env.cloud[newpos].type);
+    _cloud_index(src) = nullptr;
+    newc.pos = newpos;
+    _los_cloud_changed(src, newc.type);
+    _los_cloud_changed(newpos, newc.type);
 }
 
 void swap_clouds(coord_def p1, coord_def p2)
@@ -767,9 +806,9 @@ void place_cloud(cloud_type cl_type, const coord_def& ctarget, int cl_range,
 
     const int spread_rate = _actual_spread_rate(cl_type, _spread_rate);
 
-    env.cloud[ctarget] = cloud_struct(ctarget, cl_type, cl_range * 10,
-                                      spread_rate, whose, killer, source,
-                                      excl_rad);
+    _cloud_ref(ctarget) = cloud_struct(ctarget, cl_type, cl_range * 10,
+                                       spread_rate, whose, killer, source,
+                                       excl_rad);
 }
 
 bool is_opaque_cloud(cloud_type ctype)
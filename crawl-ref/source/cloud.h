@@ -20,6 +20,7 @@ struct cloud_tile_info
 };
 
 cloud_struct* cloud_at(coord_def pos);
+void rebuild_cloud_index();
 
 cloud_type cloud_type_at(const coord_def &pos);
 bool cloud_is_yours_at(const coord_def &pos);
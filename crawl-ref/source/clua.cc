@@ -8,6 +8,7 @@
 #include "dlua.h"
 #include "end.h"
 #include "files.h"
+#include "hash.h"
 #include "libutil.h"
 #include "l_libs.h"
 #include "misc.h" // erase_val
@@ -21,6 +22,18 @@
 #define BUGGY_PCALL_ERROR  "667: Malformed response to guarded pcall."
 #define BUGGY_SCRIPT_ERROR "666: Killing badly-behaved Lua script."
 
+// On UNIX builds the badly-behaved-script watchdog is driven by an
+// interval timer instead of a permanently installed instruction-count
+// hook, so rc-script Lua runs hook-free between samples and stops
+// paying per-instruction hook bookkeeping. lua_sethook is the one Lua
+// API call that may be made from a signal handler; the handler just
+// asks the sampled VM to run the throttle hook at its next instruction
+// boundary. LuaJIT only honours hooks reliably in its interpreter, so
+// it keeps the counted hook.
+#if defined(UNIX) && !defined(USE_LUAJIT)
+#define CLUA_THROTTLE_TIMER
+#endif
+
 // 64-bit luajit does not support custom allocators. Only checking
 // TARGET_CPU_X64 because luajit doesn't support other 64-bit archs.
 #if defined(USE_LUAJIT) && defined(TARGET_CPU_X64)
@@ -40,6 +53,63 @@
 
 static int  _clua_panic(lua_State *);
 static void _clua_throttle_hook(lua_State *, lua_Debug *);
+
+#ifdef CLUA_THROTTLE_TIMER
+#include <csignal>
+#include <sys/time.h>
+
+// Sampling period, in CPU time. Each sample applies one unit of the
+// sleep-doubling punishment in _clua_throttle_hook, so the kill
+// threshold needs roughly MAX_THROTTLE_SLEEPS samples' worth of
+// CPU-hungry script time.
+static const int THROTTLE_TIMER_MS = 200;
+
+static lua_State *_throttle_sampled_state = nullptr;
+
+static void _clua_throttle_signal(int)
+{
+    if (_throttle_sampled_state)
+    {
+        lua_sethook(_throttle_sampled_state, _clua_throttle_hook,
+                    LUA_MASKCOUNT, 1);
+    }
+}
+
+static void _clua_throttle_arm(lua_State *ls)
+{
+    static bool handler_installed = false;
+    if (!handler_installed)
+    {
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = _clua_throttle_signal;
+        sigemptyset(&sa.sa_mask);
+        // Restart interrupted syscalls: the timer must not make input
+        // reads inside Lua callbacks fail with EINTR.
+        sa.sa_flags = SA_RESTART;
+        sigaction(SIGPROF, &sa, nullptr);
+        handler_installed = true;
+    }
+
+    _throttle_sampled_state = ls;
+
+    struct itimerval t;
+    t.it_interval.tv_sec = 0;
+    t.it_interval.tv_usec = THROTTLE_TIMER_MS * 1000;
+    t.it_value = t.it_interval;
+    // CPU time, so time spent blocked on input inside a Lua callback
+    // doesn't count against the script.
+    setitimer(ITIMER_PROF, &t, nullptr);
+}
+
+static void _clua_throttle_disarm()
+{
+    struct itimerval t;
+    memset(&t, 0, sizeof(t));
+    setitimer(ITIMER_PROF, &t, nullptr);
+    _throttle_sampled_state = nullptr;
+}
+#endif
 #ifndef NO_CUSTOM_ALLOCATOR
 static void *_clua_allocator(void *ud, void *ptr, size_t osize, size_t nsize);
 #endif
@@ -125,6 +195,22 @@ void CLua::gc()
     lua_gc(state(), LUA_GCCOLLECT, 0);
 }
 
+// One incremental collection step, for quiet moments such as the wait for
+// the next command. Unlike gc(), never forces creation of the state.
+void CLua::gc_step()
+{
+    if (_state)
+        lua_gc(_state, LUA_GCSTEP, 0);
+}
+
+// The Lua heap size in kilobytes, for memory diagnostics. (memory_used
+// tracks the same thing through the custom allocator, but only for
+// managed VMs; this works for dlua too.)
+int CLua::mem_used_kb()
+{
+    return _state ? lua_gc(_state, LUA_GCCOUNT, 0) : 0;
+}
+
 void CLua::save(writer &outf)
 {
     if (!_state)
@@ -247,8 +333,12 @@ void CLua::init_throttle()
 
     if (!mixed_call_depth)
     {
+#ifdef CLUA_THROTTLE_TIMER
+        _clua_throttle_arm(_state);
+#else
         lua_sethook(_state, _clua_throttle_hook,
                     LUA_MASKCOUNT, throttle_unit_lines);
+#endif
         throttle_sleep_ms = 0;
         n_throttle_sleeps = 0;
     }
@@ -287,6 +377,84 @@ bool CLua::is_path_safe(string s, bool trusted)
            && (trusted || s.find("dlua") != 0);
 }
 
+static int _bytecode_writer(lua_State *ls, const void *p, size_t sz, void *ud)
+{
+    string *out = static_cast<string *>(ud);
+    out->append(static_cast<const char *>(p), sz);
+    return 0;
+}
+
+// Compiled chunks for trusted script files are cached under the versioned
+// save directory - so stale caches die with the binary, like the des
+// cache - keyed by a hash of the source. Servers fork a fresh process per
+// game, and this saves each one recompiling the standard clua/dlua
+// library files.
+static string _bytecode_cache_path(const string &file, const string &script)
+{
+    static string dir;
+    static bool dir_checked = false;
+    if (!dir_checked)
+    {
+        dir_checked = true;
+        string luacdir = savedir_versioned_path("luac");
+        if (check_mkdir("Lua bytecode cache", &luacdir, true))
+            dir = luacdir;
+    }
+    if (dir.empty())
+        return "";
+
+    const uint32_t hash = hash32(script.c_str(), script.length());
+    return catpath(dir, make_stringf("%s-%08x.luc",
+                                     get_base_filename(file).c_str(), hash));
+}
+
+static bool _load_cached_bytecode(lua_State *ls, const string &cachefile,
+                                  const string &file)
+{
+    FILE *fp = fopen_u(cachefile.c_str(), "rb");
+    if (!fp)
+        return false;
+
+    string bytecode;
+    char buf[4096];
+    size_t sz;
+    while ((sz = fread(buf, 1, sizeof buf, fp)) > 0)
+        bytecode.append(buf, sz);
+    fclose(fp);
+
+    if (bytecode.empty()
+        || luaL_loadbuffer(ls, bytecode.c_str(), bytecode.length(),
+                           ("@" + file).c_str()))
+    {
+        // Corrupt or truncated cache; drop it and recompile.
+        if (!bytecode.empty())
+            lua_pop(ls, 1);
+        unlink_u(cachefile.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Writes the compiled chunk on top of the stack; leaves the stack alone.
+static void _write_cached_bytecode(lua_State *ls, const string &cachefile)
+{
+    string bytecode;
+    if (lua_dump(ls, _bytecode_writer, &bytecode) || bytecode.empty())
+        return;
+
+    FILE *fp = fopen_u(cachefile.c_str(), "wb");
+    if (!fp)
+        return;
+    if (fwrite(bytecode.c_str(), 1, bytecode.length(), fp)
+        != bytecode.length())
+    {
+        fclose(fp);
+        unlink_u(cachefile.c_str());
+        return;
+    }
+    fclose(fp);
+}
+
 int CLua::loadfile(lua_State *ls, const char *filename, bool trusted,
                    bool die_on_fail)
 {
@@ -314,6 +482,25 @@ int CLua::loadfile(lua_State *ls, const char *filename, bool trusted,
     while (!f.eof())
         script += f.get_line() + "\n";
 
+    // Only trusted files may load cached bytecode: binary chunks bypass
+    // the parser, so an untrusted one could escape the rc sandbox.
+    if (trusted)
+    {
+        const string cachefile = _bytecode_cache_path(file, script);
+        if (!cachefile.empty())
+        {
+            if (_load_cached_bytecode(ls, cachefile, file))
+                return 0;
+
+            // prefixing with @ stops lua from adding [string "%s"]
+            const int err = luaL_loadbuffer(ls, &script[0], script.length(),
+                                            ("@" + file).c_str());
+            if (!err)
+                _write_cached_bytecode(ls, cachefile);
+            return err;
+        }
+    }
+
     // prefixing with @ stops lua from adding [string "%s"]
     return luaL_loadbuffer(ls, &script[0], script.length(),
                            ("@" + file).c_str());
@@ -639,9 +826,19 @@ bool CLua::proc_returns(const char *par) const
 //
 void CLua::pushglobal(const string &name)
 {
-    vector<string> pieces = split_string(".", name);
     lua_State *ls(state());
 
+    // The common case is a plain name - every per-item and per-turn hook
+    // (ch_force_autopickup, ready, ...) - which needs none of the
+    // split-and-walk machinery or its allocations.
+    if (name.find('.') == string::npos)
+    {
+        lua_getglobal(ls, name.c_str());
+        return;
+    }
+
+    vector<string> pieces = split_string(".", name);
+
     if (pieces.empty())
         lua_pushnil(ls);
 
@@ -1091,6 +1288,11 @@ static void *_clua_allocator(void *ud, void *ptr, size_t osize, size_t nsize)
 
 static void _clua_throttle_hook(lua_State *ls, lua_Debug *dbg)
 {
+#ifdef CLUA_THROTTLE_TIMER
+    // One shot per timer sample: run unhooked until the next one.
+    lua_sethook(ls, nullptr, 0, 0);
+#endif
+
     CLua *lua = lua_call_throttle::find_clua(ls);
 
     // Co-routines can create a new Lua state; in such cases, we must
@@ -1129,7 +1331,13 @@ lua_call_throttle::lua_call_throttle(CLua *_lua)
 lua_call_throttle::~lua_call_throttle()
 {
     if (!--lua->mixed_call_depth)
+    {
         lua_map.erase(lua->state());
+#ifdef CLUA_THROTTLE_TIMER
+        if (lua->managed_vm && crawl_state.throttle)
+            _clua_throttle_disarm();
+#endif
+    }
 }
 
 CLua *lua_call_throttle::find_clua(lua_State *ls)
@@ -101,6 +101,8 @@ public:
     void save_persist();
     void load_persist();
     void gc();
+    void gc_step();
+    int mem_used_kb();
 
     void setglobal(const char *name);
     void getglobal(const char *name);
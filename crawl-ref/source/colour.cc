@@ -20,9 +20,10 @@ static map<string, element_colour_calc*> element_colours_str;
 
 typedef vector< pair<int, int> > random_colour_map;
 typedef int (*randomized_element_colour_calculator)(int, const coord_def&,
-                                                    random_colour_map);
+                                                    const random_colour_map &);
 
-static int _randomized_element_colour(int, const coord_def&, random_colour_map);
+static int _randomized_element_colour(int, const coord_def&,
+                                      const random_colour_map &);
 
 struct random_element_colour_calc : public element_colour_calc
 {
@@ -30,13 +31,20 @@ struct random_element_colour_calc : public element_colour_calc
                                vector< pair<int, int> > _rand_vals)
         : element_colour_calc(_type, _name, (element_colour_calculator)_randomized_element_colour),
           rand_vals(_rand_vals)
-        {};
+    {
+        // Expand the weight list once, so get() turns the shimmer roll
+        // straight into a table read instead of walking the weights for
+        // every coloured cell of every redraw.
+        for (int r = 0; r < 120; ++r)
+            resolved[r] = _randomized_element_colour(r, coord_def(), rand_vals);
+    };
 
     virtual int get(const coord_def& loc = coord_def(),
                     bool non_random = false) override;
 
 protected:
     random_colour_map rand_vals;
+    int resolved[120];
 };
 
 int element_colour_calc::rand(bool non_random)
@@ -49,17 +57,9 @@ int element_colour_calc::get(const coord_def& loc, bool non_random)
     return (*calc)(rand(non_random), loc);
 }
 
-int random_element_colour_calc::get(const coord_def& loc, bool non_random)
+int random_element_colour_calc::get(const coord_def&, bool non_random)
 {
-    // casting function pointers from other function pointers is guaranteed
-    // to be safe, but calling them on pointers not of their type isn't, so
-    // assert here to be safe - add to this assert if something different is
-    // needed
-    ASSERT((randomized_element_colour_calculator)calc ==
-                _randomized_element_colour);
-    randomized_element_colour_calculator real_calc =
-        (randomized_element_colour_calculator)calc;
-    return (*real_calc)(rand(non_random), loc, rand_vals);
+    return resolved[rand(non_random)];
 }
 
 colour_t random_colour(bool ui_rand)
@@ -121,7 +121,7 @@ static bool _is_element_colour(int col)
 }
 
 static int _randomized_element_colour(int rand, const coord_def&,
-                                      random_colour_map rand_vals)
+                                      const random_colour_map &rand_vals)
 {
     int accum = 0;
     for (const auto &entry : rand_vals)
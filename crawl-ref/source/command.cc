@@ -1395,6 +1395,7 @@ int list_wizard_commands(bool do_redraw_screen)
                        "<w>O</w>      measure exploration time\n"
                        "<w>Ctrl-T</w> dungeon (D)Lua interpreter\n"
                        "<w>Ctrl-U</w> client (C)Lua interpreter\n"
+                       "<w>Ctrl-V</w> turn phase timing stats\n"
                        "<w>Ctrl-X</w> Xom effect stats\n"
 #ifdef DEBUG_DIAGNOSTICS
                        "<w>Ctrl-Q</w> make some debug messages quiet\n"
@@ -64,7 +64,7 @@ coord_def rotate_adjacent(coord_def vector, int direction) PURE;
 
 coord_def clamp_in_bounds(const coord_def &p) PURE;
 
-#ifdef ASSERTS
+#ifdef HOT_ASSERTS
 #  define ASSERT_IN_BOUNDS(where)                                           \
      ASSERTM(in_bounds(where), "%s = (%d,%d)", #where, (where).x, (where).y)
 #  define ASSERT_IN_BOUNDS_OR_ORIGIN(where)               \
@@ -7,6 +7,8 @@
 
 #include "coordit.h"
 
+#include <map>
+
 #include "coord.h"
 #include "libutil.h"
 #include "losglobal.h"
@@ -167,22 +169,80 @@ void random_rectangle_iterator::operator++(int)
 /*
  *  radius iterator
  */
+
+// Return the offsets covered by a disc of the given squareness and size
+// (squares use Chebyshev distance <= credit, circles dx²+dy² <= credit),
+// in the same interleaved quadrant order the iterator always emitted.
+// Tables are built on first use and shared by every subsequent iterator,
+// so iteration is a flat walk over a const array instead of recomputing
+// circle membership cell by cell.
+static const vector<coord_def> &_radius_offsets(bool is_square, int credit)
+{
+    static map<pair<bool, int>, vector<coord_def>> tables;
+
+    const pair<bool, int> key(is_square, credit);
+    auto found = tables.find(key);
+    if (found != tables.end())
+        return found->second;
+
+    vector<coord_def> &offsets = tables[key];
+
+    const int base_cost = is_square ? 1 : -1;
+    const int inc_cost = is_square ? 0 : 2;
+
+    int y = 0;
+    int cost_y = base_cost;
+    int credit_y = credit;
+
+    do
+    {
+        int x = 0;
+        int cost_x = base_cost;
+        int credit_x = (is_square ? credit : credit_y);
+
+        do
+        {
+            offsets.emplace_back(x, y);
+            if (y)
+                offsets.emplace_back(x, -y);
+            if (x)
+            {
+                offsets.emplace_back(-x, y);
+                if (y)
+                    offsets.emplace_back(-x, -y);
+            }
+            x++;
+            credit_x -= (cost_x += inc_cost);
+        } while (credit_x >= 0);
+
+        y++;
+        credit_y -= (cost_y += inc_cost);
+    } while (credit_y >= 0);
+
+    return offsets;
+}
+
+static int _radius_credit(int r, circle_type ctype)
+{
+    switch (ctype)
+    {
+    case C_POINTY: return r * r;
+    case C_ROUND:  return r * r + 1;
+    case C_CIRCLE:
+    case C_SQUARE:
+    default:       return r;
+    }
+}
+
 radius_iterator::radius_iterator(const coord_def _center, int r,
                                  circle_type ctype,
                                  bool _exclude_center)
-    : state(RI_START),
+    : idx(-1),
       center(_center),
       los(LOS_NONE)
 {
     ASSERT(map_bounds(_center));
-    switch (ctype)
-    {
-    case C_CIRCLE: credit = r; break;
-    case C_POINTY: credit = r * r; break;
-    case C_ROUND:  credit = r * r + 1; break;
-    case C_SQUARE: credit = r; break;
-    }
-    is_square = (ctype == C_SQUARE);
+    offsets = &_radius_offsets(ctype == C_SQUARE, _radius_credit(r, ctype));
     ++(*this);
     if (_exclude_center)
         ++(*this);
@@ -191,13 +251,12 @@ radius_iterator::radius_iterator(const coord_def _center, int r,
 radius_iterator::radius_iterator(const coord_def _center,
                                  los_type _los,
                                  bool _exclude_center)
-    : state(RI_START),
+    : idx(-1),
       center(_center),
       los(_los)
 {
     ASSERT(map_bounds(_center));
-    credit = los_radius;
-    is_square = true;
+    offsets = &_radius_offsets(true, los_radius);
     ++(*this);
     if (_exclude_center)
         ++(*this);
@@ -208,19 +267,12 @@ radius_iterator::radius_iterator(const coord_def _center,
                                  circle_type ctype,
                                  los_type _los,
                                  bool _exclude_center)
-    : state(RI_START),
+    : idx(-1),
       center(_center),
       los(_los)
 {
     ASSERT(map_bounds(_center));
-    switch (ctype)
-    {
-    case C_CIRCLE: credit = r; break;
-    case C_POINTY: credit = r * r; break;
-    case C_ROUND:  credit = r * r + 1; break;
-    case C_SQUARE: credit = r; break;
-    }
-    is_square = (ctype == C_SQUARE);
+    offsets = &_radius_offsets(ctype == C_SQUARE, _radius_credit(r, ctype));
     ++(*this);
     if (_exclude_center)
         ++(*this);
@@ -228,7 +280,7 @@ radius_iterator::radius_iterator(const coord_def _center,
 
 radius_iterator::operator bool() const
 {
-    return state;
+    return idx < (int)offsets->size();
 }
 
 coord_def radius_iterator::operator *() const
@@ -241,59 +293,19 @@ const coord_def* radius_iterator::operator->() const
     return &current;
 }
 
-#define coreturn(id) { state = id; return; case id:; }
-#define cobegin(id)  switch (state) { case id:
-#define coend(id)    coreturn(id); }
-#define ret_coord(dx, dy, id) do                                \
-    {                                                           \
-        current.x = center.x + (dx);                            \
-        current.y = center.y + (dy);                            \
-        if (!los || cell_see_cell(center, current, los))        \
-            coreturn(id);                                       \
-    } while (0)
-
 void radius_iterator::operator++()
 {
-    cobegin(RI_START);
-
-    base_cost = is_square ? 1 : -1;
-    inc_cost = is_square ? 0 : 2;
-
-    y = 0;
-    cost_y = base_cost;
-    credit_y = credit;
-
-    do
+    while (++idx < (int)offsets->size())
     {
-        x = 0;
-        cost_x = base_cost;
-        credit_x = (is_square ? credit : credit_y);
-
-        do
+        current = center + (*offsets)[idx];
+        if (current.x < 0 || current.x >= GXM
+            || current.y < 0 || current.y >= GYM)
         {
-            if (x + center.x < GXM)
-            {
-                if (y + center.y < GYM)
-                    ret_coord( x,  y, RI_SE);
-                if (y && y <= center.y)
-                    ret_coord( x, -y, RI_NE);
-            }
-            if (x && x <= center.x)
-            {
-                if (y + center.y < GYM)
-                    ret_coord(-x,  y, RI_SW);
-                if (y && y <= center.y)
-                    ret_coord(-x, -y, RI_NW);
-            }
-            x++;
-            credit_x -= (cost_x += inc_cost);
-        } while (credit_x >= 0);
-
-        y++;
-        credit_y -= (cost_y += inc_cost);
-    } while (credit_y >= 0);
-
-    coend(RI_DONE);
+            continue;
+        }
+        if (!los || cell_see_cell(center, current, los))
+            return;
+    }
 }
 
 void radius_iterator::operator++(int)
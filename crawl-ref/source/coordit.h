@@ -75,11 +75,8 @@ public:
     void operator ++ (int);
 
 private:
-    enum costate { RI_DONE, RI_START, RI_SE, RI_NE, RI_SW, RI_NW };
-    int x, y, cost_x, cost_y, credit, credit_x, credit_y, base_cost, inc_cost;
-    bool is_square;
-
-    costate state;
+    const vector<coord_def> *offsets; // shared table, one per (shape, radius)
+    int idx;
     coord_def center;
     los_type los;
     coord_def current;    // storage for operator->
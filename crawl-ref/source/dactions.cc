@@ -292,11 +292,10 @@ void apply_daction_to_mons(monster* mon, daction_type act, bool local,
     }
 }
 
-static void _apply_daction(daction_type act)
+// Dactions applied by walking the level's monsters, as opposed to the
+// ones that act on the level itself.
+static bool _daction_affects_monsters(daction_type act)
 {
-    ASSERT_RANGE(act, 0, NUM_DACTIONS);
-    dprf("applying delayed action: %s", daction_names[act]);
-
     switch (act)
     {
     case DACT_ALLY_HOLY:
@@ -317,11 +316,48 @@ static void _apply_daction(daction_type act)
     case DACT_KIRKE_HOGS:
     case DACT_BRIBE_TIMEOUT:
     case DACT_SET_BRIBES:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void _apply_daction(daction_type act)
+{
+    ASSERT_RANGE(act, 0, NUM_DACTIONS);
+    dprf("applying delayed action: %s", daction_names[act]);
+
+    if (_daction_affects_monsters(act))
+    {
         for (monster_iterator mi; mi; ++mi)
         {
             if (mons_matches_daction(*mi, act))
                 apply_daction_to_mons(*mi, act, true, false);
         }
+        return;
+    }
+
+    switch (act)
+    {
+    case DACT_ALLY_HOLY:
+    case DACT_ALLY_UNHOLY_EVIL:
+    case DACT_ALLY_UNCLEAN_CHAOTIC:
+    case DACT_ALLY_SPELLCASTER:
+    case DACT_ALLY_YRED_SLAVE:
+    case DACT_ALLY_BEOGH:
+    case DACT_ALLY_HEPLIAKLQANA:
+    case DACT_ALLY_SLIME:
+    case DACT_ALLY_PLANT:
+    case DACT_ALLY_TROG:
+    case DACT_ALLY_MAKHLEB:
+    case DACT_OLD_ENSLAVED_SOULS_POOF:
+    case DACT_SLIME_NEW_ATTEMPT:
+    case DACT_HOLY_PETS_GO_NEUTRAL:
+    case DACT_PIKEL_SLAVES:
+    case DACT_KIRKE_HOGS:
+    case DACT_BRIBE_TIMEOUT:
+    case DACT_SET_BRIBES:
+        // Handled by the monster walk above.
         break;
 
     case DACT_SHUFFLE_DECKS:
@@ -406,8 +442,34 @@ static void _apply_daction(daction_type act)
 
 void catchup_dactions()
 {
+    // Each monster-targeted action used to replay its own pass over the
+    // whole monster list, so revisiting an old level late in a long game
+    // paid actions * monsters. Apply the level-targeted actions in order
+    // as before, but fold every pending monster-targeted action into a
+    // single walk of the level's monsters.
+    vector<daction_type> mon_acts;
     while (env.dactions_done < you.dactions.size())
-        _apply_daction(you.dactions[env.dactions_done++]);
+    {
+        const daction_type act = you.dactions[env.dactions_done++];
+        ASSERT_RANGE(act, 0, NUM_DACTIONS);
+        if (_daction_affects_monsters(act))
+        {
+            dprf("applying delayed action: %s", daction_names[act]);
+            mon_acts.push_back(act);
+        }
+        else
+            _apply_daction(act);
+    }
+
+    if (mon_acts.empty())
+        return;
+
+    // A monster dismissed or killed by an earlier action no longer
+    // matches later ones, so per-monster ordering is preserved.
+    for (monster_iterator mi; mi; ++mi)
+        for (daction_type act : mon_acts)
+            if (mons_matches_daction(*mi, act))
+                apply_daction_to_mons(*mi, act, true, false);
 }
 
 unsigned int query_daction_counter(daction_type c)
@@ -37,8 +37,11 @@ public:
     TextDB(TextDB *parent);
     ~TextDB() { shutdown(true); delete translation; }
     void init();
+    // Loads the db on first use; a no-op once init() has run.
+    void ensure_init();
     void shutdown(bool recursive = false);
-    DBM* get() { return _db; }
+    DBM* get() { ensure_init(); return _db; }
+    bool fetch(const string &key, string &result);
 
     // Make it easier to migrate from raw DBM* to TextDB
     operator bool() const { return _db != 0; }
@@ -54,7 +57,12 @@ public:
     string _directory;
     vector<string> _input_files;
     DBM* _db;
+    // In-memory read-through cache over dbm_fetch(), holding misses as
+    // empty strings. Speech and description queries probe several keys
+    // apiece, most of them absent, and each probe is otherwise a dbm seek.
+    map<string, string> _fetch_cache;
     string timestamp;
+    bool _initialised;
     TextDB *_parent;
     const char* lang() { return _parent ? Options.lang_name : 0; }
 public:
@@ -165,7 +173,8 @@ static string _db_cache_path(string db, const char *lang)
 
 TextDB::TextDB(const char* db_name, const char* dir, ...)
     : _db_name(db_name), _directory(dir),
-      _db(nullptr), timestamp(""), _parent(0), translation(0)
+      _db(nullptr), timestamp(""), _initialised(false), _parent(0),
+      translation(0)
 {
     va_list args;
     va_start(args, dir);
@@ -187,7 +196,8 @@ TextDB::TextDB(TextDB *parent)
     : _db_name(parent->_db_name),
       _directory(parent->_directory + Options.lang_name + "/"),
       _input_files(parent->_input_files), // FIXME: pointless copy
-      _db(nullptr), timestamp(""), _parent(parent), translation(nullptr)
+      _db(nullptr), timestamp(""), _initialised(false), _parent(parent),
+      translation(nullptr)
 {
 }
 
@@ -208,8 +218,18 @@ bool TextDB::open_db()
     return true;
 }
 
+void TextDB::ensure_init()
+{
+    if (!_initialised)
+        init();
+}
+
 void TextDB::init()
 {
+    // Set before any work: open_db() queries this db for its own
+    // TIMESTAMP entry, which must not re-enter init().
+    _initialised = true;
+
     if (Options.lang_name && !_parent)
     {
         translation = new TextDB(this);
@@ -236,6 +256,7 @@ void TextDB::shutdown(bool recursive)
         dbm_close(_db);
         _db = nullptr;
     }
+    _fetch_cache.clear();
     if (recursive && translation)
         translation->shutdown(recursive);
 }
@@ -348,14 +369,21 @@ void databaseSystemInit()
     // the current version ("git submodule sync;git submodule update --init").
     ASSERT(sqlite3_threadsafe());
 
+#if defined(DGAMELAUNCH)
+    // Game servers fork one short-lived process per connection, and a
+    // session queries only a few of the databases (watchers often none
+    // at all), so loading them all up front just delays the first
+    // prompt. Each db initialises itself on first query instead.
+#elif defined(TARGET_OS_WINDOWS)
+    // Using threads for loading on Windows at the moment seems to cause
+    // random failures to find files (#5854); thus disabling it here until
+    // we can identify what's going on.
+    for (unsigned int i = 0; i < NUM_DB; i++)
+        AllDBs[i].init();
+#else
     thread_t th[NUM_DB];
     for (unsigned int i = 0; i < NUM_DB; i++)
-// Using threads for loading on Windows at the moment seems to cause
-// random failures to find files (#5854); thus disabling it here until
-// we can identify what's going on.
-#if !defined(DGAMELAUNCH) && !defined(TARGET_OS_WINDOWS)
         if (thread_create_joinable(&th[i], init_db, (void*)(intptr_t)i))
-#endif
         {
             // if thread creation fails, do it serially
             th[i] = 0;
@@ -364,6 +392,7 @@ void databaseSystemInit()
     for (unsigned int i = 0; i < NUM_DB; i++)
         if (th[i])
             thread_join(th[i]);
+#endif
 }
 
 void databaseSystemShutdown()
@@ -392,6 +421,27 @@ static datum _database_fetch(DBM *database, const string &key)
     return result;
 }
 
+// Returns true if the key is present, leaving the value in result;
+// on a miss result is cleared. Hits and misses both land in the cache,
+// so repeated probes for the same key cost one map lookup.
+bool TextDB::fetch(const string &key, string &result)
+{
+    auto cached = _fetch_cache.find(key);
+    if (cached != _fetch_cache.end())
+    {
+        result = cached->second;
+        return !result.empty();
+    }
+
+    const datum dat = _database_fetch(_db, key);
+    result.clear();
+    if (dat.dsize > 0)
+        result.assign((const char *)dat.dptr, dat.dsize);
+
+    _fetch_cache[key] = result;
+    return !result.empty();
+}
+
 static vector<string> _database_find_keys(DBM *database,
                                           const string &regex,
                                           bool ignore_case,
@@ -621,38 +671,33 @@ static string _chooseStrByWeight(string entry, int fixed_weight = -1)
 static string _getWeightedString(TextDB &db, const string &key,
                                  const string &suffix, int fixed_weight = -1)
 {
+    db.ensure_init();
+
     // We have to canonicalise the key (in case the user typed it
     // in and got the case wrong.)
     string canonical_key = key + suffix;
     lowercase(canonical_key);
 
     // Query the DB.
-    datum result;
+    string str;
 
-    if (db.translation)
-        result = _database_fetch(db.translation->get(), canonical_key);
-    if (result.dsize <= 0)
-        result = _database_fetch(db.get(), canonical_key);
+    if (!db.translation || !db.translation->fetch(canonical_key, str))
+        db.fetch(canonical_key, str);
 
-    if (result.dsize <= 0)
+    if (str.empty())
     {
         // Try ignoring the suffix.
         canonical_key = key;
         lowercase(canonical_key);
 
         // Query the DB.
-        if (db.translation)
-            result = _database_fetch(db.translation->get(), canonical_key);
-        if (result.dsize <= 0)
-            result = _database_fetch(db.get(), canonical_key);
+        if (!db.translation || !db.translation->fetch(canonical_key, str))
+            db.fetch(canonical_key, str);
 
-        if (result.dsize <= 0)
+        if (str.empty())
             return "";
     }
 
-    // Cons up a (C++) string to return. The caller must release it.
-    string str = string((const char *)result.dptr, result.dsize);
-
     return _chooseStrByWeight(str, fixed_weight);
 }
 
@@ -733,6 +778,8 @@ static void _call_recursive_replacement(string &str, TextDB &db,
 static string _query_database(TextDB &db, string key, bool canonicalise_key,
                               bool run_lua, bool untranslated)
 {
+    db.ensure_init();
+
     if (canonicalise_key)
     {
         // We have to canonicalise the key (in case the user typed it
@@ -741,18 +788,16 @@ static string _query_database(TextDB &db, string key, bool canonicalise_key,
     }
 
     // Query the DB.
-    datum result;
+    string str;
 
     if (db.translation && !untranslated)
-        result = _database_fetch(db.translation->get(), key);
-    if (result.dsize <= 0)
-        result = _database_fetch(db.get(), key);
+        db.translation->fetch(key, str);
+    if (str.empty())
+        db.fetch(key, str);
 
-    if (result.dsize <= 0)
+    if (str.empty())
         return "";
 
-    string str((const char *)result.dptr, result.dsize);
-
     // <foo> is an alias to key foo
     if (str[0] == '<' && str[str.size() - 2] == '>'
         && str.find('<', 1) == str.npos
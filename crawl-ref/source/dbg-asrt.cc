@@ -12,6 +12,7 @@
 #include "chardump.h"
 #include "coordit.h"
 #include "crash.h"
+#include "dbg-mem.h"
 #include "dbg-scan.h"
 #include "dbg-util.h"
 #include "delay.h"
@@ -695,6 +696,10 @@ void do_crash_dump()
         fprintf(file, ">>>>>>>>>>>>>>>>>>>>>>\n");
     }
 
+    // Memory owned by the major subsystems, for tracking down runaway
+    // rc or vault scripts and bloated saves.
+    dump_memory_stats(file);
+
     // Dumping the player state and crawl state is next least likely to cause
     // another crash, so do that next.
     crawl_state.dump();
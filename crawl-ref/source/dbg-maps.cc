@@ -18,7 +18,9 @@
 #include "maps.h"
 #include "message.h"
 #include "ng-init.h"
+#include "options.h"
 #include "player.h"
+#include "random.h"
 #include "shopping.h"
 #include "state.h"
 #include "stringutil.h"
@@ -41,6 +43,11 @@ static mapname_place_map map_levelsused;
 static map<string, string> errors;
 static string last_error;
 
+// Wall time spent placing each map, total and worst single attempt,
+// in microseconds.
+static map<string, int64_t> time_total;
+static map<string, int64_t> time_worst;
+
 static int levels_tried = 0, levels_failed = 0;
 static int build_attempts = 0, level_vetoes = 0;
 // Map from message to counts.
@@ -244,6 +251,15 @@ bool mapstat_build_levels()
     fflush(stdout);
     for (int i = 0; i < SysEnv.map_gen_iters; ++i)
     {
+        // With an explicit -seed, every iteration reseeds from seed + i,
+        // making it a pure function of its seed. That lets big runs be
+        // sharded across processes: worker k of n runs with
+        // -seed base+k*iters and generates exactly the slice of levels a
+        // serial run of n*iters iterations from base would. See
+        // util/mapstat-parallel for a driver that does this and merges
+        // the resulting stats.
+        if (Options.seed)
+            seed_rng(Options.seed + i);
         clear_messages();
         mprf("On %d of %d; %d g, %d fail, %u err%s, %u uniq, "
              "%d try, %d (%.2f%%) vetoes",
@@ -275,6 +291,13 @@ void mapstat_report_map_try(const map_def &map)
     try_count[map.name]++;
 }
 
+void mapstat_report_map_timing(const map_def &map, int64_t micros)
+{
+    time_total[map.name] += micros;
+    if (micros > time_worst[map.name])
+        time_worst[map.name] = micros;
+}
+
 void mapstat_report_map_use(const map_def &map)
 {
     use_count[map.name]++;
@@ -320,11 +343,56 @@ static void _check_mapless(const level_id &lid, vector<level_id> &mapless)
         mapless.push_back(lid);
 }
 
+// Output file name for this run. With an explicit -seed the seed becomes
+// part of the name, so parallel shards started with different seeds can
+// share a directory without clobbering each other's output.
+static string _stat_file_name(const char *ext)
+{
+    if (Options.seed)
+        return make_stringf("mapstat-%x%s", Options.seed, ext);
+    return string("mapstat") + ext;
+}
+
+// Dump the raw counters behind the mapstat report as tab-separated
+// lines, counts before free-form text. Unlike mapstat.log these are
+// trivially summable, so util/mapstat-parallel can merge the shards of
+// a parallel run into one report.
+static void _write_map_stats_tsv()
+{
+    const string out_file = _stat_file_name(".tsv");
+    FILE *outf = fopen(out_file.c_str(), "w");
+    printf("Writing raw map stats to %s...", out_file.c_str());
+    fflush(stdout);
+
+    fprintf(outf, "levels\t%d\t%d\n", levels_tried, levels_failed);
+    fprintf(outf, "builds\t%d\t%d\n", build_attempts, level_vetoes);
+    for (const auto &entry : try_count)
+    {
+        fprintf(outf, "map\t%d\t%d\t%d\t%s\n",
+                entry.second, lookup(use_count, entry.first, 0),
+                lookup(success_count, entry.first, 0), entry.first.c_str());
+    }
+    for (const auto &entry : map_builds)
+    {
+        fprintf(outf, "level\t%d\t%d\t%s\n",
+                entry.second.first, entry.second.second,
+                entry.first.describe().c_str());
+    }
+    for (const auto &entry : veto_messages)
+        fprintf(outf, "veto\t%d\t%s\n", entry.second, entry.first.c_str());
+    for (const auto &entry : time_total)
+    {
+        fprintf(outf, "maptime\t%" PRId64 "\t%" PRId64 "\t%s\n",
+                entry.second, time_worst[entry.first], entry.first.c_str());
+    }
+    fclose(outf);
+}
+
 static void _write_map_stats()
 {
-    const char *out_file = "mapstat.log";
-    FILE *outf = fopen(out_file, "w");
-    printf("Writing map stats to %s...", out_file);
+    const string out_file = _stat_file_name(".log");
+    FILE *outf = fopen(out_file.c_str(), "w");
+    printf("Writing map stats to %s...", out_file.c_str());
     fflush(stdout);
     fprintf(outf, "Map Generation Stats\n\n");
     fprintf(outf, "Levels attempted: %d, built: %d, failed: %d\n",
@@ -413,6 +481,28 @@ static void _write_map_stats()
             fprintf(outf, "%3d) %s\n", i + 1, unused_maps[i].c_str());
     }
 
+    // Sorted by worst single attempt: a map that occasionally takes
+    // hundreds of milliseconds to place is a deploy problem even if
+    // its average looks fine.
+    multimap<int64_t, string> slowest;
+    for (const auto &entry : time_worst)
+        if (entry.second >= 10000) // 10ms
+            slowest.insert(make_pair(entry.second, entry.first));
+
+    if (!slowest.empty())
+    {
+        fprintf(outf, "\n\nSlowest map placements "
+                      "(worst attempt, total, tries):\n");
+        int count = 0;
+        for (auto i = slowest.rbegin(); i != slowest.rend(); ++i)
+        {
+            fprintf(outf, "%3d) %6.1f ms, %8.1f ms, %4d: %s\n",
+                    ++count, i->first / 1000.0,
+                    time_total[i->second] / 1000.0,
+                    lookup(try_count, i->second, 0), i->second.c_str());
+        }
+    }
+
     fprintf(outf, "\n\nMaps by level:\n\n");
     for (const auto &entry : level_mapsused)
     {
@@ -504,6 +594,7 @@ void mapstat_generate_stats()
     // build.
     mapstat_build_levels();
     _write_map_stats();
+    _write_map_stats_tsv();
     printf("Map stats complete.\n");
 }
 
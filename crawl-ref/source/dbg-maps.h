@@ -10,6 +10,7 @@
 
 class map_def;
 void mapstat_report_map_try(const map_def &map);
+void mapstat_report_map_timing(const map_def &map, int64_t micros);
 void mapstat_report_map_use(const map_def &map);
 void mapstat_report_map_success(const string &map_name);
 void mapstat_report_error(const map_def &map, const string &err);
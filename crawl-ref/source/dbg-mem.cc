@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @brief Rough per-subsystem memory accounting.
+ *
+ * Answers "what is using the memory in this game?" without external
+ * tooling. The numbers are estimates built from container sizes and
+ * string capacities -- they ignore allocator slop -- but they are
+ * stable enough to compare across versions and to spot a subsystem
+ * that has bloated.
+**/
+
+#include "AppHdr.h"
+
+#include "dbg-mem.h"
+
+#include "clua.h"
+#include "dlua.h"
+#include "env.h"
+#include "maps.h"
+#include "message.h"
+#include "monster.h"
+#include "mon-info.h"
+#include "player.h"
+#include "stringutil.h"
+
+struct mem_subsystem
+{
+    string name;
+    size_t bytes;
+};
+
+// Heap memory hanging off the level's map knowledge: remembered items
+// and monsters are allocated per cell.
+static size_t _map_knowledge_heap()
+{
+    size_t bytes = 0;
+    for (int x = 0; x < GXM; ++x)
+        for (int y = 0; y < GYM; ++y)
+        {
+            const map_cell &cell = env.map_knowledge[x][y];
+            if (cell.item())
+                bytes += sizeof(item_info);
+            if (cell.monsterinfo())
+                bytes += sizeof(monster_info);
+        }
+    return bytes;
+}
+
+static vector<mem_subsystem> _collect_memory_stats()
+{
+    vector<mem_subsystem> stats;
+
+    stats.push_back({ "env (fixed planes)", sizeof(env) });
+    stats.push_back({ "map knowledge (heap)", _map_knowledge_heap() });
+
+    size_t item_bytes = 0;
+    int items_used = 0;
+    for (int i = 0; i < MAX_ITEMS; ++i)
+    {
+        const item_def &item = mitm[i];
+        if (!item.defined())
+            continue;
+        items_used++;
+        item_bytes += item.props.estimate_size()
+                      + item.inscription.capacity();
+    }
+    stats.push_back({ make_stringf("floor items (%d slots)", items_used),
+                      item_bytes });
+
+    size_t mons_bytes = 0;
+    int mons_used = 0;
+    for (int i = 0; i < MAX_MONSTERS; ++i)
+    {
+        const monster &mons = menv[i];
+        if (!mons.alive())
+            continue;
+        mons_used++;
+        mons_bytes += mons.props.estimate_size()
+                      + mons.mname.capacity()
+                      + mons.travel_path.capacity() * sizeof(coord_def)
+                      + mons.spells.capacity() * sizeof(mon_spell_slot);
+    }
+    stats.push_back({ make_stringf("monsters (%d alive)", mons_used),
+                      mons_bytes });
+
+    stats.push_back({ "you.props", you.props.estimate_size() });
+    stats.push_back({ "level props", env.properties.estimate_size() });
+    stats.push_back({ "message history", messages_memory_used() });
+    stats.push_back({ make_stringf("vault defs (%d maps)", map_count()),
+                      map_memory_used() });
+    stats.push_back({ "clua", (size_t)clua.mem_used_kb() * 1024 });
+    stats.push_back({ "dlua", (size_t)dlua.mem_used_kb() * 1024 });
+
+    return stats;
+}
+
+void debug_memory_report()
+{
+    size_t total = 0;
+    mprf(MSGCH_DIAGNOSTICS, "Approximate memory usage by subsystem:");
+    for (const mem_subsystem &stat : _collect_memory_stats())
+    {
+        mprf(MSGCH_DIAGNOSTICS, "%-22s %8d KB",
+             stat.name.c_str(), (int)(stat.bytes / 1024));
+        total += stat.bytes;
+    }
+    mprf(MSGCH_DIAGNOSTICS, "%-22s %8d KB", "total (tracked)",
+         (int)(total / 1024));
+}
+
+void dump_memory_stats(FILE *file)
+{
+    size_t total = 0;
+    fprintf(file, "\nApproximate memory usage by subsystem:\n");
+    for (const mem_subsystem &stat : _collect_memory_stats())
+    {
+        fprintf(file, "%-22s %8d KB\n",
+                stat.name.c_str(), (int)(stat.bytes / 1024));
+        total += stat.bytes;
+    }
+    fprintf(file, "%-22s %8d KB\n", "total (tracked)",
+            (int)(total / 1024));
+}
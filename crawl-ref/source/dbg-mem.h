@@ -0,0 +1,18 @@
+/**
+ * @file
+ * @brief Rough per-subsystem memory accounting.
+**/
+
+#ifndef DBG_MEM_H
+#define DBG_MEM_H
+
+#include <cstdio>
+
+// Wizmode report (Ctrl-N) of approximately how much memory the major
+// owners are holding.
+void debug_memory_report();
+
+// The same numbers, written into a crash report.
+void dump_memory_stats(FILE *file);
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * @file
+ * @brief Lightweight timing of the main turn loop's phases.
+ *
+ * Collection is always on: it costs two clock reads per timed phase per
+ * turn, which is noise next to what the phases themselves do. Reporting
+ * is wizmode-only (Ctrl-V), which also arms a crawl.prf dump on exit so
+ * runs can be compared between builds.
+**/
+
+#include "AppHdr.h"
+
+#include "dbg-perf.h"
+
+#include <cstdio>
+#ifndef TARGET_OS_WINDOWS
+#include <sys/time.h>
+#endif
+
+#include "message.h"
+#include "player.h"
+#include "version.h"
+
+static const char *_phase_names[NUM_PERF_PHASES] =
+{
+    "world_reacts",
+    "player_reacts",
+    "monster turns",
+    "timed effects",
+    "viewwindow",
+    "save",
+};
+
+int64_t perf_now_micros()
+{
+#ifdef TARGET_OS_WINDOWS
+    // MSVC has no gettimeofday().
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+    uint64_t tt = ft.dwHighDateTime;
+    tt <<= 32;
+    tt |= ft.dwLowDateTime;
+    return (int64_t)(tt / 10);
+#else
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+#endif
+}
+
+struct perf_turn_sample
+{
+    int64_t phase_micros[NUM_PERF_PHASES];
+};
+
+// Per-turn samples for the most recent turns, plus running totals over
+// the whole session.
+static const int PERF_RING_SIZE = 512;
+static perf_turn_sample _ring[PERF_RING_SIZE];
+static perf_turn_sample _current;
+static int _ring_pos    = 0;
+static int _ring_count  = 0;
+static int64_t _totals[NUM_PERF_PHASES];
+static int64_t _turns_sampled = 0;
+static bool _dump_on_exit = false;
+
+perf_phase_timer::perf_phase_timer(perf_phase phase)
+    : _phase(phase), _start_micros(perf_now_micros())
+{
+}
+
+perf_phase_timer::~perf_phase_timer()
+{
+    _current.phase_micros[_phase] += perf_now_micros() - _start_micros;
+}
+
+void perf_end_turn()
+{
+    _ring[_ring_pos] = _current;
+    _ring_pos = (_ring_pos + 1) % PERF_RING_SIZE;
+    if (_ring_count < PERF_RING_SIZE)
+        _ring_count++;
+
+    for (int i = 0; i < NUM_PERF_PHASES; ++i)
+    {
+        _totals[i] += _current.phase_micros[i];
+        _current.phase_micros[i] = 0;
+    }
+    _turns_sampled++;
+}
+
+// Average and worst per-phase times over the ring buffer.
+static void _ring_stats(perf_phase phase, int64_t &avg, int64_t &worst)
+{
+    avg = worst = 0;
+    if (!_ring_count)
+        return;
+
+    int64_t sum = 0;
+    for (int i = 0; i < _ring_count; ++i)
+    {
+        const int64_t t = _ring[i].phase_micros[phase];
+        sum += t;
+        if (t > worst)
+            worst = t;
+    }
+    avg = sum / _ring_count;
+}
+
+void debug_dump_perf_stats()
+{
+    if (!_turns_sampled)
+    {
+        mpr("No turns sampled yet.");
+        return;
+    }
+
+    mprf(MSGCH_DIAGNOSTICS,
+         "Phase timings over %d recent / %" PRId64 " total turns "
+         "(avg/worst recent, avg total, in microseconds):",
+         _ring_count, _turns_sampled);
+    for (int i = 0; i < NUM_PERF_PHASES; ++i)
+    {
+        int64_t avg, worst;
+        _ring_stats((perf_phase)i, avg, worst);
+        mprf(MSGCH_DIAGNOSTICS, "%-14s %7" PRId64 " / %7" PRId64
+             "   %7" PRId64,
+             _phase_names[i], avg, worst, _totals[i] / _turns_sampled);
+    }
+
+    if (!_dump_on_exit)
+    {
+        _dump_on_exit = true;
+        mpr("Phase timings will be written to crawl.prf on exit.");
+    }
+}
+
+void perf_stats_shutdown()
+{
+    if (!_dump_on_exit || !_turns_sampled)
+        return;
+
+    FILE *f = fopen("crawl.prf", "a");
+    if (!f)
+        return;
+
+    fprintf(f, "%s %s: %" PRId64 " turns\n", CRAWL, Version::Long,
+            _turns_sampled);
+    fprintf(f, "%-14s %12s %12s %12s\n",
+            "phase", "avg recent", "worst recent", "avg total");
+    for (int i = 0; i < NUM_PERF_PHASES; ++i)
+    {
+        int64_t avg, worst;
+        _ring_stats((perf_phase)i, avg, worst);
+        fprintf(f, "%-14s %12" PRId64 " %12" PRId64 " %12" PRId64 "\n",
+                _phase_names[i], avg, worst, _totals[i] / _turns_sampled);
+    }
+    fprintf(f, "\n");
+    fclose(f);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file
+ * @brief Lightweight timing of the main turn loop's phases.
+**/
+
+#ifndef DBG_PERF_H
+#define DBG_PERF_H
+
+// Phases of world_reacts() (and friends) that get timed separately.
+// Phases may nest; nested time is counted in both phases.
+enum perf_phase
+{
+    PERF_WORLD_REACTS,   // all of world_reacts()
+    PERF_PLAYER_REACTS,
+    PERF_MONSTER_TURNS,  // handle_monsters()
+    PERF_TIMED_EFFECTS,  // handle_time(), clouds, mold, ...
+    PERF_VIEWWINDOW,     // end-of-turn view redraw
+    PERF_SAVE,           // save_game()
+    NUM_PERF_PHASES,
+};
+
+// Scoped timer: accumulates the lifetime of the object into the current
+// turn's sample for the given phase.
+class perf_phase_timer
+{
+public:
+    perf_phase_timer(perf_phase phase);
+    ~perf_phase_timer();
+
+private:
+    perf_phase _phase;
+    int64_t    _start_micros;
+};
+
+// Close out the current turn's sample and push it into the ring buffer.
+void perf_end_turn();
+
+// Wizmode report of the collected numbers; also arms the crawl.prf dump
+// on exit.
+void debug_dump_perf_stats();
+
+// Write crawl.prf, if armed. Called from end().
+void perf_stats_shutdown();
+
+// Monotonic-enough wall clock in microseconds, shared with the other
+// debug instrumentation.
+int64_t perf_now_micros();
+
+#endif
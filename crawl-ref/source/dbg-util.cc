@@ -12,6 +12,7 @@
 #include "dungeon.h"
 #include "libutil.h"
 #include "macro.h"
+#include "maps.h"
 #include "message.h"
 #include "options.h"
 #include "religion.h"
@@ -98,6 +99,27 @@ void debug_dump_levgen()
             mprf("    %s", vault_name.c_str());
         }
     }
+
+    const map<string, map_build_profile> &profiles = mapgen_build_profiles();
+    if (!profiles.empty())
+    {
+        // Costliest maps first; the long cheap tail is noise.
+        multimap<int64_t, string, greater<int64_t>> by_cost;
+        for (const auto &entry : profiles)
+            by_cost.insert(make_pair(entry.second.micros, entry.first));
+
+        mpr("Map placement cost for this build (time, tries, vetoes):");
+        int shown = 0;
+        for (const auto &entry : by_cost)
+        {
+            const map_build_profile &prof = profiles.find(entry.second)->second;
+            mprf("    %6.1f ms, %2d, %2d: %s",
+                 prof.micros / 1000.0, prof.tries, prof.vetoes,
+                 entry.second.c_str());
+            if (++shown >= 10)
+                break;
+        }
+    }
     mpr("");
 }
 
@@ -95,6 +95,28 @@ NORETURN void AssertFailed(const char *expr, const char *file, int line,
 
 #endif
 
+// Hot-path assertion tier: checks in code that runs millions of times
+// per turn (per-cell grid indexing, coordinate bounds). They behave
+// like the plain assertions by default; building with NOHOTASSERTS=y
+// keeps the critical assertions but compiles the hot-path ones into
+// unreachability hints, so the optimiser can delete the comparisons
+// instead of just the failure handler. Ignored in debug builds, like
+// NOASSERTS.
+#if defined(ASSERTS) && (!defined(NOHOTASSERTS) || defined(DEBUG))
+#define HOT_ASSERTS
+#endif
+
+#ifdef HOT_ASSERTS
+#define ASSERT_HOT(p) ASSERT(p)
+#elif defined(__GNUC__) || defined(__clang__)
+#define ASSERT_HOT(p)                       \
+    do {                                    \
+        if (!(p)) __builtin_unreachable();  \
+    } while (false)
+#else
+#define ASSERT_HOT(p)                     ((void) 0)
+#endif
+
 NORETURN void die(const char *file, int line, PRINTF(2, ));
 #define die(...) die(__FILE__, __LINE__, __VA_ARGS__)
 
@@ -2388,14 +2388,17 @@ bool describe_item(item_def &item, function<void (string&)> fixup_desc)
 
     string desc = get_item_description(item, true, false);
 
+    // Hints and tutorial games never show quotes; don't look one up.
     string quote;
-    if (is_unrandom_artefact(item) && item_type_known(item))
-        quote = getQuoteString(get_artefact_name(item));
-    else
-        quote = getQuoteString(item.name(DESC_DBNAME, true, false, false));
+    if (!crawl_state.game_is_hints_tutorial())
+    {
+        if (is_unrandom_artefact(item) && item_type_known(item))
+            quote = getQuoteString(get_artefact_name(item));
+        else
+            quote = getQuoteString(item.name(DESC_DBNAME, true, false, false));
+    }
 
-    if (!(crawl_state.game_is_hints_tutorial()
-          || quote.empty()))
+    if (!quote.empty())
     {
         desc += "\n\n" + quote;
     }
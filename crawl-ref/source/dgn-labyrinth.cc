@@ -18,8 +18,6 @@
 #include "mon-place.h"
 #include "terrain.h"
 
-typedef list<coord_def> coord_list;
-
 struct dist_feat
 {
     int dist;
@@ -33,10 +31,8 @@ struct dist_feat
 
 static void _find_maze_neighbours(const coord_def &c,
                                   const dgn_region &region,
-                                  coord_list &ns)
+                                  vector<coord_def> &ns)
 {
-    vector<coord_def> coords;
-
     for (int yi = -2; yi <= 2; yi += 2)
         for (int xi = -2; xi <= 2; xi += 2)
         {
@@ -45,23 +41,18 @@ static void _find_maze_neighbours(const coord_def &c,
 
             const coord_def cp(c.x + xi, c.y + yi);
             if (region.contains(cp))
-                coords.push_back(cp);
+                ns.push_back(cp);
         }
 
-    while (!coords.empty())
-    {
-        const int n = random2(coords.size());
-        ns.push_back(coords[n]);
-        coords.erase(coords.begin() + n);
-    }
+    shuffle_array(ns);
 }
 
 static void _labyrinth_maze_recurse(const coord_def &c, const dgn_region &where)
 {
-    coord_list neighbours;
+    vector<coord_def> neighbours;
     _find_maze_neighbours(c, where, neighbours);
 
-    coord_list deferred;
+    vector<coord_def> deferred;
     for (auto nc : neighbours)
     {
         if (grd(nc) != DNGN_ROCK_WALL)
@@ -251,19 +242,40 @@ static void _place_extra_lab_minivaults()
     }
 }
 
-// Checks if there is a square with the given mask within radius of pos.
-static bool _has_vault_in_radius(const coord_def &pos, int radius,
-                                 unsigned mask)
+// Flags every square within the given (Chebyshev) radius of a square
+// carrying the mask. Computed once per build: the entry-point search
+// samples up to 2000 points and the glass placement several more, and
+// each test used to rescan a radius-5 disc of the map mask.
+static void _compute_vault_nearby(int radius, unsigned mask,
+                                  FixedArray<bool, GXM, GYM> &near_vault)
 {
-    for (radius_iterator rad(pos, radius, C_SQUARE); rad; ++rad)
-    {
-        if (!in_bounds(*rad))
-            continue;
-        if (map_masked(*rad, mask))
-            return true;
-    }
+    FixedArray<bool, GXM, GYM> row_hit(false);
 
-    return false;
+    // The disc is separable: dilate along rows, then along columns.
+    for (int y = 0; y < GYM; ++y)
+        for (int x = 0; x < GXM; ++x)
+        {
+            if (!map_masked(coord_def(x, y), mask))
+                continue;
+            for (int dx = max(0, x - radius);
+                 dx <= min(GXM - 1, x + radius); ++dx)
+            {
+                row_hit[dx][y] = true;
+            }
+        }
+
+    near_vault.init(false);
+    for (int y = 0; y < GYM; ++y)
+        for (int x = 0; x < GXM; ++x)
+        {
+            if (!row_hit[x][y])
+                continue;
+            for (int dy = max(0, y - radius);
+                 dy <= min(GYM - 1, y + radius); ++dy)
+            {
+                near_vault[x][dy] = true;
+            }
+        }
 }
 
 // Find an entry point that's:
@@ -271,7 +283,9 @@ static bool _has_vault_in_radius(const coord_def &pos, int radius,
 // * At least 5 squares away from the nearest vault.
 // * Floor (well, obviously).
 static coord_def _labyrinth_find_entry_point(const dgn_region &reg,
-                                             const coord_def &end)
+                                             const coord_def &end,
+                                             const FixedArray<bool, GXM, GYM>
+                                                 &near_vault)
 {
     const int min_distance = 24;
     // Try many times.
@@ -284,7 +298,7 @@ static coord_def _labyrinth_find_entry_point(const dgn_region &reg,
         if ((place - end).rdist() < min_distance)
             continue;
 
-        if (_has_vault_in_radius(place, 5, MMT_VAULT))
+        if (near_vault(place))
             continue;
 
         return place;
@@ -294,9 +308,11 @@ static coord_def _labyrinth_find_entry_point(const dgn_region &reg,
 }
 
 static void _labyrinth_place_entry_point(const dgn_region &region,
-                                         const coord_def &pos)
+                                         const coord_def &pos,
+                                         const FixedArray<bool, GXM, GYM>
+                                             &near_vault)
 {
-    const coord_def p = _labyrinth_find_entry_point(region, pos);
+    const coord_def p = _labyrinth_find_entry_point(region, pos, near_vault);
     if (in_bounds(p))
         env.markers.add(new map_feature_marker(p, DNGN_ENTER_LABYRINTH));
 }
@@ -462,7 +478,9 @@ static void _vitrify_wall_and_neighbours(const coord_def& pos, bool first)
 }
 
 // Turns some connected rock or stone walls into the transparent versions.
-static void _labyrinth_add_glass_walls(const dgn_region &region)
+static void _labyrinth_add_glass_walls(const dgn_region &region,
+                                       const FixedArray<bool, GXM, GYM>
+                                           &near_vault)
 {
     int glass_num = 2 + random2(6);
 
@@ -475,7 +493,7 @@ static void _labyrinth_add_glass_walls(const dgn_region &region)
         if (!_find_random_nonmetal_wall(region, pos))
             break;
 
-        if (_has_vault_in_radius(pos, 5, MMT_VAULT))
+        if (near_vault(pos))
             continue;
 
         _vitrify_wall_and_neighbours(pos, true);
@@ -534,10 +552,15 @@ void dgn_build_labyrinth_level()
 
     _change_labyrinth_border(lab, DNGN_PERMAROCK_WALL);
 
+    // All vaults are in place now; flag their surroundings once for the
+    // placement searches below.
+    FixedArray<bool, GXM, GYM> near_vault(false);
+    _compute_vault_nearby(5, MMT_VAULT, near_vault);
+
     _labyrinth_add_blood_trail(lab);
-    _labyrinth_add_glass_walls(lab);
+    _labyrinth_add_glass_walls(lab, near_vault);
 
-    _labyrinth_place_entry_point(lab, end);
+    _labyrinth_place_entry_point(lab, end, near_vault);
 
     link_items();
 }
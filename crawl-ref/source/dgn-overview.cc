@@ -249,15 +249,16 @@ static string _get_seen_branches(bool display)
         if (branch == BRANCH_ZIGGURAT)
             continue;
 
-        if (branch == root_branch
-            || stair_level.count(branch))
+        const set<level_id> *entries = map_find(stair_level, branch);
+        if (branch == root_branch || entries)
         {
             level_id lid(branch, 0);
             lid = find_deepest_explored(lid);
 
             string entry_desc;
-            for (auto lvl : stair_level[branch])
-                entry_desc += " " + lvl.describe(false, true);
+            if (entries)
+                for (auto lvl : *entries)
+                    entry_desc += " " + lvl.describe(false, true);
 
             // "D" is a little too short here.
             const char *brname = (branch == BRANCH_DUNGEON
@@ -535,15 +536,24 @@ static string _get_portals()
 // Loop through each branch, printing stored notes.
 static string _get_notes()
 {
+    // Gather the levels with anything to report up front: the triple
+    // annotation lookup per level is wasted on the hundred-plus levels
+    // that have none. level_id sorts by depth within a branch, so the
+    // per-branch output order is unchanged.
+    set<level_id> noted;
+    for (const auto &entry : level_annotations)
+        noted.insert(entry.first);
+    for (const auto &entry : level_exclusions)
+        noted.insert(entry.first);
+    for (const auto &entry : level_uniques)
+        noted.insert(entry.first);
+
     string disp;
 
     for (branch_iterator it; it; ++it)
-        for (int d = 1; d <= brdepth[it->id]; ++d)
-        {
-            level_id i(it->id, d);
-            if (!get_level_annotation(i).empty())
+        for (const level_id &i : noted)
+            if (i.branch == it->id && !get_level_annotation(i).empty())
                 disp += _get_coloured_level_annotation(i) + "\n";
-        }
 
     if (disp.empty())
         return disp;
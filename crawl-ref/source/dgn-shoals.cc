@@ -909,23 +909,123 @@ static vector<coord_def> _shoals_extra_tide_seeds()
     return find_marker_positions_by_prop("tide_seed");
 }
 
+// The tide never creates or destroys deep water: deep water isn't
+// susceptible to tide effects, and receding water bottoms out at
+// DNGN_SHALLOW_WATER. Any deep water square connected to the tide seeds
+// is therefore permanently wet and propagates the tide unconditionally,
+// so the bulk of the flood fill -- walking the open sea every tide
+// tick -- always produces the same answer. Cache that interior ("the
+// ocean") and the squares bordering it once per level, and start each
+// tick's fill at the border instead of the map corners. Only the
+// shoreline squares that can actually change are then visited.
+static bool _tide_cache_valid = false;
+static level_id _tide_cache_level;
+static FixedArray<bool, GXM, GYM> _tide_ocean(false);
+static vector<coord_def> _tide_ocean_border;
+static bool _tide_in_progress = false;
+
+// Called from dungeon_terrain_changed for Shoals levels. The tide's own
+// floor <-> shallow water flips can't touch deep water and are ignored;
+// anything else (vault placement, temporary terrain, wizmode edits)
+// might carve up the ocean, so throw the cache away.
+void shoals_terrain_changed()
+{
+    if (!_tide_in_progress)
+        _tide_cache_valid = false;
+}
+
+static void _shoals_rebuild_tide_cache()
+{
+    _tide_ocean.init(false);
+    _tide_ocean_border.clear();
+
+    // Flood from the same places the tide fill used to start at, but
+    // only through deep water. Squares under temporary terrain are
+    // excluded: they rejoin the ocean (and invalidate this cache) when
+    // the terrain change reverts.
+    vector<coord_def> frontier;
+    frontier.emplace_back(1,1);
+    frontier.emplace_back(GXM - 2, 1);
+    frontier.emplace_back(1, GYM - 2);
+    frontier.emplace_back(GXM - 2, GYM - 2);
+    const vector<coord_def> extra_seeds(_shoals_extra_tide_seeds());
+    frontier.insert(frontier.end(), extra_seeds.begin(), extra_seeds.end());
+
+    FixedArray<bool, GXM, GYM> considered(false);
+    while (!frontier.empty())
+    {
+        const coord_def c = frontier.back();
+        frontier.pop_back();
+        if (considered(c))
+            continue;
+        considered(c) = true;
+        if (grd(c) != DNGN_DEEP_WATER || is_temp_terrain(c))
+            continue;
+        _tide_ocean(c) = true;
+        for (adjacent_iterator ai(c); ai; ++ai)
+            if (in_bounds(*ai) && !considered(*ai))
+                frontier.push_back(*ai);
+    }
+
+    FixedArray<bool, GXM, GYM> on_border(false);
+    for (rectangle_iterator ri(1); ri; ++ri)
+    {
+        if (!_tide_ocean(*ri))
+            continue;
+        for (adjacent_iterator ai(*ri); ai; ++ai)
+            if (in_bounds(*ai) && !_tide_ocean(*ai) && !on_border(*ai))
+            {
+                on_border(*ai) = true;
+                _tide_ocean_border.push_back(*ai);
+            }
+    }
+}
+
 static void _shoals_apply_tide(int tide, bool incremental_tide)
 {
+    if (!_tide_cache_valid || _tide_cache_level != level_id::current())
+    {
+        _shoals_rebuild_tide_cache();
+        _tide_cache_valid = true;
+        _tide_cache_level = level_id::current();
+    }
+    unwind_bool tide_running(_tide_in_progress, true);
+
     vector<coord_def> pages[2];
     int current_page = 0;
 
-    // Start from corners of the map.
-    pages[current_page].emplace_back(1,1);
-    pages[current_page].emplace_back(GXM - 2, 1);
-    pages[current_page].emplace_back(1, GYM - 2);
-    pages[current_page].emplace_back(GXM - 2, GYM - 2);
+    // The ocean interior is pre-marked as seen; its border squares
+    // stand in for it as fill seeds. Border squares the tide can't
+    // enter still lose bloodspatter, as they would have when the
+    // adjacent ocean squares were walked directly.
+    FixedArray<bool, GXM, GYM> seen_points(_tide_ocean);
+    for (const coord_def &c : _tide_ocean_border)
+    {
+        const dungeon_feature_type feat = grd(c);
+        if (_shoals_tide_passable_feat(feat)
+            || _shoals_tide_susceptible_feat(feat))
+        {
+            pages[current_page].push_back(c);
+        }
+        else if (is_bloodcovered(c) && one_chance_in(15))
+            _shoals_tide_wash_blood_away_at(c);
+    }
 
-    // Find any extra seeds -- markers with tide_seed="y".
-    const vector<coord_def> extra_seeds(_shoals_extra_tide_seeds());
-    pages[current_page].insert(pages[current_page].end(),
-                               extra_seeds.begin(), extra_seeds.end());
+    // Start from corners of the map, for levels whose margin isn't
+    // deep water all the way round.
+    if (!seen_points(coord_def(1,1)))
+        pages[current_page].emplace_back(1,1);
+    if (!seen_points(coord_def(GXM - 2, 1)))
+        pages[current_page].emplace_back(GXM - 2, 1);
+    if (!seen_points(coord_def(1, GYM - 2)))
+        pages[current_page].emplace_back(1, GYM - 2);
+    if (!seen_points(coord_def(GXM - 2, GYM - 2)))
+        pages[current_page].emplace_back(GXM - 2, GYM - 2);
 
-    FixedArray<bool, GXM, GYM> seen_points(false);
+    // Find any extra seeds -- markers with tide_seed="y".
+    for (const coord_def &c : _shoals_extra_tide_seeds())
+        if (!seen_points(c))
+            pages[current_page].push_back(c);
 
     while (!pages[current_page].empty())
     {
@@ -8,6 +8,7 @@ bool dgn_shoals_connect_point(const coord_def &point,
 void shoals_postprocess_level();
 void shoals_apply_tides(int turns_elapsed, bool force,
                         bool incremental_tide);
+void shoals_terrain_changed();
 void shoals_release_tide(monster* caller);
 
 #ifdef WIZARD
@@ -145,6 +145,11 @@ void dgn_event_dispatcher::remove_listener(dgn_event_listener *listener,
             if (i->listener == listener)
             {
                 listeners.erase(i);
+                // Narrow the mask again, so events nobody listens for
+                // anymore go back to being dropped up front.
+                global_event_mask = 0;
+                for (const auto &ldef : listeners)
+                    global_event_mask |= ldef.eventmask;
                 return;
             }
         }
@@ -6,7 +6,7 @@
 #ifndef __DGNEVENT_H__
 #define __DGNEVENT_H__
 
-#include <list>
+#include <vector>
 
 #include "player.h"
 
@@ -77,7 +77,7 @@ struct dgn_square_alarm
     dgn_square_alarm() : eventmask(0), listeners() { }
 
     unsigned eventmask;
-    list<dgn_event_listener*> listeners;
+    vector<dgn_event_listener*> listeners;
 };
 
 struct dgn_listener_def
@@ -130,7 +130,7 @@ private:
 private:
     unsigned global_event_mask;
     unique_ptr<dgn_square_alarm> grid_triggers[GXM][GYM];
-    list<dgn_listener_def> listeners;
+    vector<dgn_listener_def> listeners;
 };
 
 extern dgn_event_dispatcher dungeon_events;
@@ -1003,7 +1003,10 @@ bool direction_chooser::move_is_ok() const
 // Assuming the target is in view, is line-of-fire blocked?
 static bool _blocked_ray(const coord_def &where)
 {
-    return !exists_ray(you.pos(), where, opc_solid_see);
+    // Target cycling probes this for every candidate on each
+    // keystroke; go through the pairwise LOS cache rather than
+    // re-running a ray search per probe.
+    return !cell_see_cell(you.pos(), where, LOS_SOLID_SEE);
 }
 
 // Try to find an enemy monster to target
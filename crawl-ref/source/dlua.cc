@@ -112,6 +112,7 @@ void dlua_chunk::clear()
     first = last = -1;
     error.clear();
     compiled.clear();
+    cached_fn.reset();
 }
 
 void dlua_chunk::set_file(const string &s)
@@ -148,11 +149,20 @@ int dlua_chunk::check_op(CLua &interp, int err)
 
 int dlua_chunk::load(CLua &interp)
 {
+    if (cached_fn && &cached_fn->lua == &interp)
+    {
+        cached_fn->push();
+        return 0;
+    }
+
     if (!compiled.empty())
     {
-        return check_op(interp,
+        const int err = check_op(interp,
                          interp.loadbuffer(compiled.c_str(), compiled.length(),
                                            context.c_str()));
+        if (!err)
+            cached_fn.reset(new lua_datum(interp, -1, false));
+        return err;
     }
 
     if (empty())
@@ -174,6 +184,22 @@ int dlua_chunk::load(CLua &interp)
         lua_pop(interp, 2);
     }
     compiled = out.str();
+    if (!err)
+        cached_fn.reset(new lua_datum(interp, -1, false));
+    return err;
+}
+
+// Compile the chunk to bytecode without leaving the chunk function on the
+// Lua stack. Used when writing map caches, so later games marshall in the
+// bytecode and skip the Lua parser entirely.
+int dlua_chunk::compile(CLua &interp)
+{
+    if (!compiled.empty() || empty())
+        return 0;
+
+    const int err = load(interp);
+    if (!err)
+        lua_pop(interp, 1);
     return err;
 }
 
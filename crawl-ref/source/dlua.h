@@ -30,6 +30,11 @@ private:
     string context;
     int first, last;     // First and last lines of the original source.
 
+    // The closure load() built from `compiled`, kept as a registry ref so
+    // repeated runs of the same chunk (vault placement retries re-execute
+    // preludes constantly) skip re-undumping the bytecode.
+    shared_ptr<lua_datum> cached_fn;
+
     enum chunk_t
     {
         CT_EMPTY,
@@ -57,6 +62,7 @@ public:
     void set_chunk(const string &s);
 
     int load(CLua &interp);
+    int compile(CLua &interp);
     int run(CLua &interp);
     int load_call(CLua &interp, const char *function);
     void set_file(const string &s);
@@ -69,6 +75,14 @@ public:
 
     const string &compiled_chunk() const { return compiled; }
 
+    // Rough heap footprint, for the wizmode memory report.
+    size_t estimate_size() const
+    {
+        return sizeof(*this) + file.capacity() + chunk.capacity()
+               + compiled.capacity() + context.capacity()
+               + error.capacity();
+    }
+
     void write(writer&) const;
     void read(reader&);
 };
@@ -275,6 +275,34 @@ static void _count_gold()
     }
 }
 
+#define LEVELGEN_SEED_KEY   "levelgen_seed"
+#define LEVELGEN_BUILDS_KEY "levelgen_builds"
+
+// Key the level-generation stream off the game seed and the level being
+// built, so a connected-branch level regenerates identically from
+// (seed, level) alone. Branches that rebuild levels under the same id
+// (the Abyss, Pan, portal vaults) mix in a running build count as well,
+// so successive builds still vary; so do the map/objstat generators,
+// which build the same level many times over to collect statistics.
+static void _seed_levelgen_rng()
+{
+    if (!you.props.exists(LEVELGEN_SEED_KEY))
+        you.props[LEVELGEN_SEED_KEY].get_int64() = (int64_t)get_uint64();
+
+    uint64_t key[3] =
+    {
+        (uint64_t)you.props[LEVELGEN_SEED_KEY].get_int64(),
+        (uint64_t)you.where_are_you << 32 | (uint32_t)you.depth,
+        0,
+    };
+    if (!is_connected_branch(you.where_are_you)
+        || crawl_state.map_stat_gen || crawl_state.obj_stat_gen)
+    {
+        key[2] = (uint64_t)++you.props[LEVELGEN_BUILDS_KEY].get_int();
+    }
+    seed_rng_stream(RNG_LEVELGEN, key, ARRAYSZ(key));
+}
+
 /**********************************************************************
  * builder() - kickoff for the dungeon generator.
  *********************************************************************/
@@ -295,6 +323,15 @@ bool builder(bool enable_random_maps, dungeon_feature_type dest_stairs_type)
 
     unwind_bool levelgen(crawl_state.generating_level, true);
 
+    // Start the placement-cost profile fresh, so the wizmode levgen
+    // dump reflects only the level we actually ended up with.
+    clear_mapgen_build_profiles();
+
+    // All build randomness comes from the per-level stream; seeding once
+    // here means veto retries continue it deterministically.
+    _seed_levelgen_rng();
+    rng_redirect levelgen_rng(RNG_LEVELGEN);
+
     // N tries to build the level, after which we bail with a capital B.
     int tries = 50;
     while (tries-- > 0)
@@ -311,6 +348,10 @@ bool builder(bool enable_random_maps, dungeon_feature_type dest_stairs_type)
                 for (monster_iterator mi; mi; ++mi)
                     gozag_set_bribe(*mi);
 
+                // Vault Lua churns a lot of garbage; collect it at this
+                // boundary rather than during play.
+                dlua.gc();
+
                 return true;
             }
         }
@@ -677,7 +718,9 @@ static bool _dgn_fill_zone(
     bool (*iswanted)(const coord_def &) = nullptr)
 {
     bool ret = false;
-    list<coord_def> points[2];
+    // Plain vectors; a list would pay an allocation per visited cell, and
+    // this fill runs over the whole level many times per build.
+    vector<coord_def> points[2];
     int cur = 0;
 
     // No bounds checks, assuming the level has at least one layer of
@@ -888,11 +931,59 @@ static int _process_disconnected_zones(int x1, int y1, int x2, int y2,
     return nzones - ngood;
 }
 
+// The repeated full-level floodfills behind the connectivity vetoes are
+// only needed when something the passability predicate reads has actually
+// changed. Terrain is written through too many paths (builder primitives,
+// layout generators, Lua) for explicit invalidation to be trustworthy, so
+// the memo is keyed on a hash of those inputs instead: the feature grid,
+// the opaque/mimic map mask bits, the trap list, and the level the stair
+// predicates are evaluated for.
+static uint64_t _dgn_connectivity_hash()
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+#define MIX(v) hash = (hash ^ static_cast<uint64_t>(v)) * 0x100000001b3ULL
+    for (int y = 0; y < GYM; ++y)
+        for (int x = 0; x < GXM; ++x)
+        {
+            MIX(grd[x][y]);
+            MIX(env.level_map_mask[x][y] & (MMT_OPAQUE | MMT_MIMIC));
+        }
+
+    for (const auto &entry : env.trap)
+    {
+        MIX(entry.first.x + (entry.first.y << 8));
+        MIX(entry.second.type);
+    }
+
+    MIX(you.where_are_you);
+    MIX(you.depth);
+#undef MIX
+    return hash;
+}
+
+static uint64_t _zone_count_hash[2];
+static int      _zone_count_cache[2] = { -1, -1 };
+
 int dgn_count_disconnected_zones(bool choose_stairless,
                                  dungeon_feature_type fill)
 {
-    return _process_disconnected_zones(0, 0, GXM-1, GYM-1, choose_stairless,
-                                       fill);
+    // Filling mutates the level, so only plain counts are memoised.
+    if (fill)
+    {
+        return _process_disconnected_zones(0, 0, GXM-1, GYM-1,
+                                           choose_stairless, fill);
+    }
+
+    const int which = choose_stairless ? 1 : 0;
+    const uint64_t hash = _dgn_connectivity_hash();
+    if (_zone_count_cache[which] >= 0 && _zone_count_hash[which] == hash)
+        return _zone_count_cache[which];
+
+    const int count = _process_disconnected_zones(0, 0, GXM-1, GYM-1,
+                                                  choose_stairless, fill);
+    _zone_count_hash[which]  = hash;
+    _zone_count_cache[which] = count;
+    return count;
 }
 
 static void _fixup_hell_stairs()
@@ -1125,6 +1216,8 @@ void dgn_reset_level(bool enable_random_maps)
     env.level_uniq_map_tags.clear();
     clear_subvault_stack();
 
+    _zone_count_cache[0] = _zone_count_cache[1] = -1;
+
     you.unique_creatures = temp_unique_creatures;
     you.unique_items = temp_unique_items;
 
@@ -1177,6 +1270,7 @@ void dgn_reset_level(bool enable_random_maps)
     setup_vault_mon_list();
 
     env.cloud.clear();
+    rebuild_cloud_index();
 
     mgrd.init(NON_MONSTER);
     igrd.init(NON_ITEM);
@@ -14,8 +14,10 @@
 #include "colour.h"
 #include "crash.h"
 #include "database.h"
+#include "dbg-perf.h"
 #include "describe.h"
 #include "dungeon.h"
+#include "files.h"
 #include "godpassive.h"
 #include "hints.h"
 #include "invent.h"
@@ -147,6 +149,7 @@ NORETURN void end(int exit_code, bool print_error, const char *format, ...)
         msg::deinitialise_mpr_streams();
         _clear_globals_on_exit();
         databaseSystemShutdown();
+        perf_stats_shutdown();
 #ifdef DEBUG_PROPS
         dump_prop_accesses();
 #endif
@@ -193,6 +196,7 @@ NORETURN void end(int exit_code, bool print_error, const char *format, ...)
 static void _delete_files()
 {
     crawl_state.need_save = false;
+    unlink_save_info_cache(you.save->get_filename());
     you.save->unlink();
     delete you.save;
     you.save = 0;
@@ -316,19 +320,6 @@ NORETURN void end_game(scorefile_entry &se, int hiscore_index)
     else
         you.delay_queue.clear(); // don't lose ev for taking the exit...
 
-    string fname = morgue_name(you.your_name, se.get_death_time());
-    if (!dump_char(fname, true, true, &se))
-    {
-        mpr("Char dump unsuccessful! Sorry about that.");
-        if (!crawl_state.seen_hups)
-            more();
-        clrscr();
-    }
-#ifdef USE_TILE_WEB
-    else
-        tiles.send_dump_info("morgue", fname);
-#endif
-
 #if defined(DGL_WHEREIS) || defined(USE_TILE_WEB)
     string reason = se.get_death_type() == KILLED_BY_QUITTING? "quit" :
                     se.get_death_type() == KILLED_BY_WINNING ? "won"  :
@@ -342,6 +333,24 @@ NORETURN void end_game(scorefile_entry &se, int hiscore_index)
     if (!crawl_state.seen_hups)
         more();
 
+    // Build and write the morgue only after the death screen has been
+    // dismissed: generating it (inventory, notes, kill list, stash and
+    // map side files) is the one piece of real work between the death
+    // message and accepting input, and here it hides in the transition
+    // to the inventory screen instead of delaying the prompt.
+    string fname = morgue_name(you.your_name, se.get_death_time());
+    if (!dump_char(fname, true, true, &se))
+    {
+        mpr("Char dump unsuccessful! Sorry about that.");
+        if (!crawl_state.seen_hups)
+            more();
+        clrscr();
+    }
+#ifdef USE_TILE_WEB
+    else
+        tiles.send_dump_info("morgue", fname);
+#endif
+
     if (!crawl_state.disables[DIS_CONFIRMATIONS])
         display_inventory();
     textcolour(LIGHTGREY);
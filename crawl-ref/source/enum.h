@@ -1404,6 +1404,7 @@ enum level_state_type
     LSTATE_BEOGH          = (1 << 3), // Possibly an orcish priest around.
     LSTATE_SLIMY_WALL     = (1 << 4), // Any slime walls exist.
     LSTATE_STILL_WINDS    = (1 << 5), // Cloud generation is disabled
+    LSTATE_WATERY         = (1 << 6), // Any watery cells might exist.
 };
 
 // NOTE: The order of these is very important to their usage!
@@ -5280,6 +5281,7 @@ enum timed_effect_type
 enum rng_type {
     RNG_GAMEPLAY,
     RNG_UI,
+    RNG_LEVELGEN,
     NUM_RNGS,
 };
 
@@ -181,7 +181,7 @@ exclude_set::exclude_set()
 void exclude_set::clear()
 {
     exclude_roots.clear();
-    exclude_points.clear();
+    exclude_points.reset();
 }
 
 void exclude_set::erase(const coord_def &p)
@@ -215,18 +215,18 @@ void exclude_set::add_exclude_points(travel_exclude& ex)
 {
     if (ex.radius == 0)
     {
-        exclude_points.insert(ex.pos);
+        exclude_points.set(ex.pos);
         return;
     }
 
+    // Only stale exclusions get their LOS recomputed; merging an
+    // up-to-date footprint is just bit tests.
     if (!ex.uptodate)
         ex.set_los();
-    else
-        ex.los.update();
 
     for (radius_iterator ri(ex.pos, ex.radius, C_SQUARE); ri; ++ri)
         if (ex.affects(*ri))
-            exclude_points.insert(*ri);
+            exclude_points.set(*ri);
 }
 
 void exclude_set::update_excluded_points(bool recompute_los)
@@ -244,11 +244,14 @@ void exclude_set::update_excluded_points(bool recompute_los)
 
 void exclude_set::recompute_excluded_points(bool recompute_los)
 {
-    exclude_points.clear();
+    exclude_points.reset();
     for (iterator it = exclude_roots.begin(); it != exclude_roots.end(); ++it)
     {
         travel_exclude &ex = it->second;
-        if (recompute_los)
+        // A terrain change marks exactly the exclusions whose range it
+        // touches as stale (_mark_excludes_non_updated); the rest keep
+        // their footprints, so only recompute LOS where it went stale.
+        if (recompute_los && !ex.uptodate)
             ex.set_los();
         add_exclude_points(ex);
     }
@@ -256,7 +259,7 @@ void exclude_set::recompute_excluded_points(bool recompute_los)
 
 bool exclude_set::is_excluded(const coord_def &p) const
 {
-    return exclude_points.count(p);
+    return map_bounds(p) && exclude_points.get(p);
 }
 
 bool exclude_set::is_exclude_root(const coord_def &p) const
@@ -312,6 +315,11 @@ static void _mark_excludes_non_updated(const coord_def &p)
 
 void init_exclusion_los()
 {
+    // Footprints may have been computed against another level's
+    // knowledge (excludes are loaded before the level is fully set up),
+    // so force a clean recompute of every exclusion here.
+    for (auto &entry : curr_excludes)
+        entry.second.uptodate = false;
     curr_excludes.recompute_excluded_points(true);
 }
 
@@ -85,10 +85,10 @@ public:
     iterator  end();
 
 private:
-    typedef set<coord_def> exclset;
-
     exclmap exclude_roots;
-    exclset exclude_points;
+    // The merged footprint of all exclusions, so travel's per-cell
+    // exclusion test is a bit lookup.
+    map_bitmask exclude_points;
 
 private:
     void add_exclude_points(travel_exclude& ex);
@@ -799,6 +799,10 @@ public:
     void remove_markers_at(const coord_def &c, map_marker_type type = MAT_ANY);
     map_marker *find(const coord_def &c, map_marker_type type = MAT_ANY);
     map_marker *find(map_marker_type type);
+    // Cheaper than get_all().empty() for per-turn "anything pending?"
+    // checks: no vector copy.
+    bool have_any(map_marker_type type) const
+    { return !markers_by_type[type].empty(); }
     void move(const coord_def &from, const coord_def &to);
     void move_marker(map_marker *marker, const coord_def &to);
     vector<map_marker*> get_all(map_marker_type type = MAT_ANY);
@@ -824,6 +828,10 @@ private:
 
 private:
     dgn_marker_map markers;
+    // Markers bucketed by type, so type-filtered queries (and property
+    // scans, which only a couple of marker types can answer) need not
+    // walk every marker on the level.
+    vector<map_marker *> markers_by_type[NUM_MAP_MARKER_TYPES];
     bool have_inactive_markers;
 };
 
@@ -8,7 +8,7 @@
 #define COLOUR_IS(colour) COLOURS(colour, DARKGREY)
 // And for when colour and map_colour are equal:
 #define COLOUR_AND_MAP(colour) COLOURS(colour, colour)
-static feature_def feat_defs[] =
+static const feature_def feat_defs[] =
 {
 
 {
@@ -145,7 +145,7 @@ static void _init_feature_index()
     }
 }
 
-/** Called at startup to perform fixups on feat_defs and fill in item_defs
+/** Called at startup to build the feat_defs index and fill in item_defs
  *  and {invis,cloud}_fd.
  */
 void init_show_table()
@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <map>
 #include <string>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -33,6 +34,7 @@
 #include "cloud.h"
 #include "coordit.h"
 #include "dactions.h"
+#include "dbg-perf.h"
 #include "dgn-overview.h"
 #include "directn.h"
 #include "dungeon.h"
@@ -43,6 +45,7 @@
 #include "godabil.h"
 #include "godcompanions.h"
 #include "godpassive.h"
+#include "hash.h"
 #include "hints.h"
 #include "initfile.h"
 #include "items.h"
@@ -68,6 +71,7 @@
 #ifdef USE_TILE
  // TODO -- dolls
  #include "tiledef-player.h"
+ #include "tiledoll.h"
  #include "tilepick-p.h"
 #endif
 #include "tileview.h"
@@ -95,6 +99,10 @@ static bool _read_char_chunk(package *save);
 
 const short GHOST_SIGNATURE = short(0xDC55);
 
+// Level property marking a level that was built speculatively and hasn't
+// been entered yet; see pregenerate_level().
+#define PREGEN_LEVEL_KEY "pregenerated"
+
 const int GHOST_LIMIT = 27; // max number of ghost files per level
 
 static void _redraw_all()
@@ -108,6 +116,14 @@ static void _redraw_all()
     you.redraw_status_lights = true;
 }
 
+// Sidecar cache of the character info shown in the save browser,
+// refreshed whenever the game is saved. Listing saves otherwise has to
+// open every package and unmarshal its "chr" chunk, which takes seconds
+// on network-backed save directories. The cache records the save file's
+// mtime; any mismatch (or a version difference) makes the browser fall
+// back to the package and rewrite the cache.
+#define SAVE_INFO_CACHE_SUFFIX ".chr"
+
 static bool is_save_file_name(const string &name)
 {
     int off = name.length() - strlen(SAVE_SUFFIX);
@@ -584,7 +600,19 @@ static bool _readln(chunk_reader &rd, char *buf)
     return true;
 }
 
-static void _fill_player_doll(player_save_info &p, package *save)
+static string _read_doll_line(package *save)
+{
+    if (!save->has_chunk("tdl"))
+        return "";
+
+    chunk_reader fdoll(save, "tdl");
+    char fbuf[LINEMAX];
+    if (_readln(fdoll, fbuf))
+        return fbuf;
+    return "";
+}
+
+static void _fill_player_doll(player_save_info &p, const string &doll_line)
 {
     dolls_data equip_doll;
     for (unsigned int j = 0; j < TILEP_PART_MAX; ++j)
@@ -595,15 +623,14 @@ static void _fill_player_doll(player_save_info &p, package *save)
 
     bool success = false;
 
-    chunk_reader fdoll(save, "tdl");
+    if (!doll_line.empty())
     {
         char fbuf[LINEMAX];
-        if (_readln(fdoll,fbuf))
-        {
-            tilep_scan_parts(fbuf, equip_doll, p.species, p.experience_level);
-            tilep_race_default(p.species, p.experience_level, &equip_doll);
-            success = true;
-        }
+        strncpy(fbuf, doll_line.c_str(), sizeof(fbuf) - 1);
+        fbuf[sizeof(fbuf) - 1] = 0;
+        tilep_scan_parts(fbuf, equip_doll, p.species, p.experience_level);
+        tilep_race_default(p.species, p.experience_level, &equip_doll);
+        success = true;
     }
 
     if (!success) // Use default doll instead.
@@ -618,6 +645,91 @@ static void _fill_player_doll(player_save_info &p, package *save)
 }
 #endif
 
+static void _write_character_info_cache(const string &savepath,
+                                        const player_save_info &p,
+                                        const string &doll_line)
+{
+    const string cachepath = savepath + SAVE_INFO_CACHE_SUFFIX;
+    FILE *f = fopen_u(cachepath.c_str(), "wb");
+    if (!f)
+        return; // only a cache; the package stays authoritative
+
+    writer outf(cachepath, f, true);
+    marshallUByte(outf, TAG_MAJOR_VERSION);
+    marshallUByte(outf, TAG_MINOR_VERSION);
+    marshallSigned(outf, file_modtime(savepath));
+    marshallString(outf, p.name);
+    marshallInt(outf, p.experience);
+    marshallInt(outf, p.experience_level);
+    marshallBoolean(outf, p.wizard);
+    marshallShort(outf, p.species);
+    marshallString(outf, p.species_name);
+    marshallString(outf, p.class_name);
+    marshallShort(outf, p.religion);
+    marshallString(outf, p.god_name);
+    marshallString(outf, p.jiyva_second_name);
+    marshallUByte(outf, p.saved_game_type);
+    marshallBoolean(outf, p.save_loadable);
+    marshallString(outf, doll_line);
+    fclose(f);
+}
+
+static bool _read_character_info_cache(const string &savepath,
+                                       player_save_info &p)
+{
+    const string cachepath = savepath + SAVE_INFO_CACHE_SUFFIX;
+    if (!file_exists(cachepath))
+        return false;
+
+    try
+    {
+        reader inf(cachepath);
+        // The cache encodes enums with this binary's meanings, so
+        // require an exact version match; the mtime check catches saves
+        // touched since the cache was written (crashes, old binaries).
+        if (unmarshallUByte(inf) != TAG_MAJOR_VERSION
+            || unmarshallUByte(inf) != TAG_MINOR_VERSION
+            || unmarshallSigned(inf) != (int64_t)file_modtime(savepath))
+        {
+            return false;
+        }
+
+        p.name             = unmarshallString(inf);
+        p.experience       = unmarshallInt(inf);
+        p.experience_level = unmarshallInt(inf);
+        p.wizard           = unmarshallBoolean(inf);
+        p.species          = static_cast<species_type>(unmarshallShort(inf));
+        p.species_name     = unmarshallString(inf);
+        p.class_name       = unmarshallString(inf);
+        p.religion         = static_cast<god_type>(unmarshallShort(inf));
+        p.god_name         = unmarshallString(inf);
+        p.jiyva_second_name= unmarshallString(inf);
+        p.saved_game_type  = static_cast<game_type>(unmarshallUByte(inf));
+        p.save_loadable    = unmarshallBoolean(inf);
+        const string doll_line = unmarshallString(inf);
+#ifdef USE_TILE
+        if (Options.tile_menu_icons && !doll_line.empty())
+            _fill_player_doll(p, doll_line);
+#else
+        UNUSED(doll_line);
+#endif
+        return !p.name.empty();
+    }
+    catch (short_read_exception &E)
+    {
+        return false;
+    }
+    catch (ext_fail_exception &E)
+    {
+        return false;
+    }
+}
+
+void unlink_save_info_cache(const string &save_path)
+{
+    unlink_u((save_path + SAVE_INFO_CACHE_SUFFIX).c_str());
+}
+
 /*
  * Returns a list of the names of characters that are already saved for the
  * current user.
@@ -640,17 +752,32 @@ static vector<player_save_info> _find_saved_characters()
     {
         if (is_save_file_name(filename))
         {
+            const string path = _get_savedir_path(filename);
+            player_save_info p;
+            if (_read_character_info_cache(path, p))
+            {
+                p.filename = filename;
+                chars.push_back(p);
+                continue;
+            }
+
             try
             {
-                package save(_get_savedir_path(filename).c_str(), false);
-                player_save_info p = _read_character_info(&save);
+                package save(path.c_str(), false);
+                p = _read_character_info(&save);
                 if (!p.name.empty())
                 {
                     p.filename = filename;
 #ifdef USE_TILE
-                    if (Options.tile_menu_icons && save.has_chunk("tdl"))
-                        _fill_player_doll(p, &save);
+                    const string doll_line = _read_doll_line(&save);
+                    if (Options.tile_menu_icons && !doll_line.empty())
+                        _fill_player_doll(p, doll_line);
+#else
+                    const string doll_line;
 #endif
+                    // Refresh the cache so the next listing needn't
+                    // open this package.
+                    _write_character_info_cache(path, p, doll_line);
                     chars.push_back(p);
                 }
             }
@@ -740,15 +867,63 @@ static void _write_ghost_version(writer &outf)
         marshallInt(outf, 0);
 }
 
+// Fingerprints of the chunks most recently written to each save file,
+// keyed by save filename and chunk name. Stair-scumming and travel save
+// levels over and over without changing anything in them; when the
+// marshalled bytes come out identical to what's already in the package,
+// the compression and disk I/O can be skipped outright.
+struct chunk_fingerprint
+{
+    size_t len;
+    uint32_t head_hash, tail_hash;
+
+    bool operator==(const chunk_fingerprint &other) const
+    {
+        return len == other.len && head_hash == other.head_hash
+               && tail_hash == other.tail_hash;
+    }
+};
+
+static map<string, chunk_fingerprint> _chunk_fingerprints;
+
+static chunk_fingerprint _fingerprint_chunk(const vector<unsigned char> &data)
+{
+    // Two independent halves plus the length; a single 32-bit hash over
+    // the whole blob leaves too much room for a collision to silently
+    // drop a save.
+    chunk_fingerprint fprint;
+    fprint.len = data.size();
+    fprint.head_hash = hash32(&data[0], data.size() / 2);
+    fprint.tail_hash = hash32(&data[data.size() / 2],
+                              data.size() - data.size() / 2);
+    return fprint;
+}
+
 static void _write_tagged_chunk(const string &chunkname, tag_type tag)
 {
-    writer outf(you.save, chunkname);
+    vector<unsigned char> buf;
+    writer tagw(&buf);
 
     // write version
-    marshallUByte(outf, TAG_MAJOR_VERSION);
-    marshallUByte(outf, TAG_MINOR_VERSION);
+    marshallUByte(tagw, TAG_MAJOR_VERSION);
+    marshallUByte(tagw, TAG_MINOR_VERSION);
+
+    tag_write(tag, tagw);
+
+    const string key = you.save->get_filename() + ":" + chunkname;
+    const chunk_fingerprint fprint = _fingerprint_chunk(buf);
+
+    map<string, chunk_fingerprint>::const_iterator
+        old = _chunk_fingerprints.find(key);
+    if (old != _chunk_fingerprints.end() && old->second == fprint
+        && you.save->has_chunk(chunkname))
+    {
+        return;
+    }
 
-    tag_write(tag, outf);
+    writer outf(you.save, chunkname);
+    outf.write(&buf[0], buf.size());
+    _chunk_fingerprints[key] = fprint;
 }
 
 static int _get_dest_stair_type(branch_type old_branch,
@@ -1210,6 +1385,9 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
     // Did we get here by popping the level stack?
     bool popped = false;
 
+    // Is this the first real visit to a pregenerated level?
+    bool pregen_entry = false;
+
     coord_def return_pos; //TODO: initialize to null
     if (load_mode != LOAD_VISITOR)
         popped = _leave_level(stair_taken, old_level, &return_pos);
@@ -1285,6 +1463,15 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
         dprf("Loading old level '%s'.", level_name.c_str());
         _restore_tagged_chunk(you.save, level_name, TAG_LEVEL, "Level file is invalid.");
 
+        if (load_mode == LOAD_ENTER_LEVEL
+            && env.properties.exists(PREGEN_LEVEL_KEY))
+        {
+            // First real visit to a speculatively built level; give it
+            // the new-level treatment generation would have.
+            env.properties.erase(PREGEN_LEVEL_KEY);
+            pregen_entry = true;
+        }
+
         _redraw_all();
     }
 
@@ -1302,8 +1489,11 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
     if (make_changes || load_mode == LOAD_RESTART_GAME)
         env.markers.activate_all();
 
-    if (make_changes && env.elapsed_time && !just_created_level)
+    if (make_changes && env.elapsed_time && !just_created_level
+        && !pregen_entry)
+    {
         update_level(you.elapsed_time - env.elapsed_time);
+    }
 
     // Apply all delayed actions, if any.
     if (just_created_level)
@@ -1336,7 +1526,7 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
     {
         // Tell stash-tracker and travel that we've changed levels.
         trackers_init_new_level(true);
-        tile_new_level(just_created_level);
+        tile_new_level(just_created_level || pregen_entry);
     }
     else if (load_mode == LOAD_RESTART_GAME)
     {
@@ -1354,13 +1544,13 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
     {
         // new levels have less wary monsters, and we don't
         // want them to attack players quite as soon:
-        you.time_taken *= (just_created_level ? 1 : 2);
+        you.time_taken *= (just_created_level || pregen_entry ? 1 : 2);
 
         you.time_taken = div_rand_round(you.time_taken * 3, 4);
 
         dprf("arrival time: %d", you.time_taken);
 
-        if (just_created_level)
+        if (just_created_level || pregen_entry)
             run_map_epilogues();
     }
 
@@ -1398,7 +1588,7 @@ bool load_level(dungeon_feature_type stair_taken, load_mode_type load_mode,
             delta.num_visits++;
         }
 
-        if (just_created_level)
+        if (just_created_level || pregen_entry)
             delta.levels_seen++;
 
         you.global_info += delta;
@@ -1509,11 +1699,32 @@ static void _save_level(const level_id& lid)
 # define CHUNK(short, long) long
 #endif
 
-#define SAVEFILE(short, long, savefn)           \
-    do                                          \
-    {                                           \
-        writer w(you.save, CHUNK(short, long)); \
-        savefn(w);                              \
+// Serialized copies of the chunks last written to you.save, so repeated
+// checkpoint saves can skip chunks whose content hasn't changed (the
+// save file still holds an identical copy). Keyed by chunk name; the
+// has_chunk() check makes a stale entry from a previous game harmless.
+static map<string, vector<unsigned char>> _last_saved_chunks;
+
+static void _write_chunk_if_changed(const string &chunkname,
+                                    vector<unsigned char> &buf)
+{
+    vector<unsigned char> &last = _last_saved_chunks[chunkname];
+    if (last == buf && you.save->has_chunk(chunkname))
+        return;
+
+    writer w(you.save, chunkname);
+    if (!buf.empty())
+        w.write(&buf[0], buf.size());
+    last.swap(buf);
+}
+
+#define SAVEFILE(short, long, savefn)                     \
+    do                                                    \
+    {                                                     \
+        vector<unsigned char> buf;                        \
+        writer w(&buf);                                   \
+        savefn(w);                                        \
+        _write_chunk_if_changed(CHUNK(short, long), buf); \
     } while (false)
 
 // Stack allocated string's go in separate function, so Valgrind doesn't
@@ -1585,8 +1796,31 @@ static void _save_game_exit()
     you.save = 0;
 }
 
+// Refresh the save-browser sidecar for the current game. Must run after
+// the package has been committed (or closed), so the mtime it records
+// matches what a later listing will see on disk.
+static void _write_save_info_cache()
+{
+    player_save_info p;
+    p = you;
+    p.save_loadable = true;
+
+    string doll_line;
+#ifdef USE_TILE
+    dolls_data result = player_doll;
+    fill_doll_equipment(result);
+    char fbuf[80];
+    tilep_print_parts(fbuf, result);
+    doll_line = fbuf;
+#endif
+
+    _write_character_info_cache(get_savedir_filename(you.your_name), p,
+                                doll_line);
+}
+
 void save_game(bool leave_game, const char *farewellmsg)
 {
+    perf_phase_timer save_timer(PERF_SAVE);
     unwind_bool saving_game(crawl_state.saving_game, true);
 
 
@@ -1612,13 +1846,17 @@ void save_game(bool leave_game, const char *farewellmsg)
     if (!leave_game)
     {
         if (!crawl_state.disables[DIS_SAVE_CHECKPOINTS])
+        {
             you.save->commit();
+            _write_save_info_cache();
+        }
         return;
     }
 
     // Stack allocated string's go in separate function,
     // so Valgrind doesn't complain.
     _save_game_exit();
+    _write_save_info_cache();
 
     if (Options.restart_after_game && Options.restart_after_save
         && !crawl_state.seen_hups)
@@ -1655,13 +1893,19 @@ static vector<string> _list_bones()
 {
     string bonefile_dir = _get_bonefile_directory();
     string base_filename = _make_ghost_filename();
-    string underscored_filename = base_filename + "_";
 
-    vector<string> filenames = get_dir_files(bonefile_dir);
+    // Bones filenames are deterministic, so the possible slots for this
+    // level can be checked directly, without listing the shared bones
+    // directory, which on a busy server holds files for every level of
+    // every game.
     vector<string> bonefiles;
-    for (const auto &filename : filenames)
-        if (starts_with(filename, underscored_filename))
-            bonefiles.push_back(bonefile_dir + filename);
+    for (int i = 0; i < GHOST_LIMIT; i++)
+    {
+        const string bonefile = make_stringf("%s%s_%d", bonefile_dir.c_str(),
+                                             base_filename.c_str(), i);
+        if (access(bonefile.c_str(), F_OK) == 0)
+            bonefiles.push_back(bonefile);
+    }
 
     string old_bonefile = _get_old_bonefile_directory() + base_filename;
     if (access(old_bonefile.c_str(), F_OK) == 0)
@@ -1847,6 +2091,7 @@ static bool _restore_game(const string& filename)
                   ).c_str(),
                   true, 'n'))
         {
+            unlink_save_info_cache(you.save->get_filename());
             you.save->unlink();
             you.save = 0;
             return false;
@@ -1940,7 +2185,10 @@ bool restore_game(const string& filename)
                   true, 'n'))
         {
             if (you.save)
+            {
+                unlink_save_info_cache(you.save->get_filename());
                 you.save->unlink();
+            }
             you.save = 0;
             return false;
         }
@@ -1998,8 +2246,54 @@ void level_excursion::go_to(const level_id& next)
     {
         ever_changed_levels = true;
 
+        // The level being left is always saved: for peeked levels that
+        // persists whatever the excursion did to them, and for the
+        // original level it keeps the save consistent while we're away.
         _save_level(level_id::current());
-        _load_level(next);
+
+        // Leaving the original level: park its environment in memory so
+        // the return trip is a structure move rather than a reload of
+        // the serialized level.
+        if (level_id::current() == original && !parked)
+        {
+            parked.reset(new crawl_environment(move(env)));
+            // The cloud index still points into the parked level's
+            // env.cloud; don't leave it dangling over the moved-from
+            // map in case the load below bails out.
+            rebuild_cloud_index();
+        }
+
+        if (next == original && parked)
+        {
+            you.where_are_you = next.branch;
+            you.depth = next.depth;
+
+            // Drop the peeked level's dungeon listeners before its
+            // markers are destroyed by the assignment below.
+            dungeon_events.clear();
+            env = move(*parked);
+            parked.reset();
+
+            // The restore repopulated env.cloud wholesale; repoint the
+            // cloud index at it before los_changed() starts querying
+            // opacity below.
+            rebuild_cloud_index();
+
+            // Mirror what a LOAD_VISITOR load of the original would
+            // have done: flush LOS, apply any dactions added while away,
+            // and rebuild per-level state. The parked markers are
+            // inactive clones, reactivated by the destructor as usual.
+            deleteAll(env.final_effects);
+            los_changed();
+            show_update_emphasis();
+            catchup_dactions();
+            crawl_view.set_player_at(you.pos(), false);
+            setup_environment_effects();
+            setup_vault_mon_list();
+            _redraw_all();
+        }
+        else
+            _load_level(next);
 
         LevelInfo &li = travel_cache.get_level_info(next);
         li.set_level_excludes();
@@ -2024,6 +2318,64 @@ level_excursion::~level_excursion()
     }
 }
 
+// Speculatively build a not-yet-visited level and stash it in the save,
+// so actually taking the stairs there becomes a plain load. Arrival
+// effects that normally accompany generation (map epilogues, the fresh
+// level treatment) are deferred to the first real visit via the
+// PREGEN_LEVEL_KEY property checked in load_level().
+//
+// The builder runs synchronously on the global environment, so like an
+// excursion this may only be called at a safe point in the command loop.
+bool pregenerate_level(const level_id &dest)
+{
+    if (!you.save || is_existing_level(dest)
+        || dest == level_id::current()
+        || env.level_state & LSTATE_DELETED)
+    {
+        return false;
+    }
+
+    const level_id original = level_id::current();
+
+    _save_level(original);
+
+    unwind_var<coord_def> saved_position(you.position);
+    you.position.reset();
+
+    you.where_are_you    = dest.branch;
+    you.depth            = dest.depth;
+    you.on_current_level = false;
+
+    _make_level(DNGN_STONE_STAIRS_DOWN_I, original);
+    env.properties[PREGEN_LEVEL_KEY] = true;
+    env.dactions_done = you.dactions.size();
+    _save_level(dest);
+
+    _load_level(original);
+    you.on_current_level = true;
+
+    // Quietly reactivate markers, as when returning from an excursion.
+    env.markers.activate_all(false);
+
+    return true;
+}
+
+// Build the next level down in the current branch, if the player hasn't
+// been there yet. Called when a long rest starts, so the descent that
+// typically follows doesn't have to wait for the builder.
+void pregenerate_next_level()
+{
+    const level_id here = level_id::current();
+
+    if (!is_connected_branch(here.branch)
+        || here.depth < 1 || here.depth >= brdepth[here.branch])
+    {
+        return;
+    }
+
+    pregenerate_level(level_id(here.branch, here.depth + 1));
+}
+
 bool get_save_version(reader &file, int &major, int &minor)
 {
     // Read first two bytes.
@@ -2211,7 +2563,11 @@ static bool _ghost_version_compatible(reader &inf)
 /**
  * Attempt to open a new bones file for saving ghosts.
  *
- * @param[out] return_gfilename     The name of the file created, if any.
+ * The handle returned is for a temporary file next to the chosen slot;
+ * the caller renames it into place once the ghosts are fully written,
+ * so other games only ever see complete bones files.
+ *
+ * @param[out] return_gfilename     The name of the slot reserved, if any.
  * @return                          A FILE object, or nullptr.
  **/
 static FILE* _make_bones_file(string * return_gfilename)
@@ -2223,13 +2579,33 @@ static FILE* _make_bones_file(string * return_gfilename)
     {
         const string g_file_name = make_stringf("%s%s_%d", bone_dir.c_str(),
                                                 base_filename.c_str(), i);
-        FILE *gfil = lk_open_exclusive(g_file_name);
-        // need to check file size, so can't open 'wb' - would truncate!
+        if (access(g_file_name.c_str(), F_OK) == 0)
+            continue; // slot already taken
+
+        // Exclusive creation of the temporary reserves the slot against
+        // other games racing for it.
+        const string tmp_name = g_file_name + ".tmp";
+        FILE *gfil = lk_open_exclusive(tmp_name);
 
         if (!gfil)
         {
-            dprf("Could not open %s", g_file_name.c_str());
-            continue;
+            // A temporary with no finished bones file next to it is an
+            // orphan from a game that died mid-save; it would block
+            // this slot forever, since nothing else ever looks at it.
+            // A live writer holds its temporary only for an instant, so
+            // anything old is safe to reclaim.
+            const time_t mtime = file_modtime(tmp_name);
+            if (mtime && time(nullptr) - mtime > 60
+                && unlink(tmp_name.c_str()) == 0)
+            {
+                dprf("Reclaimed stale bones temporary %s", tmp_name.c_str());
+                gfil = lk_open_exclusive(tmp_name);
+            }
+            if (!gfil)
+            {
+                dprf("Could not open %s", tmp_name.c_str());
+                continue;
+            }
         }
 
         dprf("found %s", g_file_name.c_str());
@@ -2304,12 +2680,21 @@ void save_ghost(bool force)
         return;
     }
 
-    writer outw(g_file_name, ghost_file);
+    const string tmp_file_name = g_file_name + ".tmp";
+    writer outw(tmp_file_name, ghost_file);
 
     _write_ghost_version(outw);
     tag_write(TAG_GHOST, outw);
 
-    lk_close(ghost_file, g_file_name);
+    lk_close(ghost_file, tmp_file_name);
+
+    if (rename_u(tmp_file_name.c_str(), g_file_name.c_str()))
+    {
+        mprf(MSGCH_ERROR, "ERROR: could not rename bones file %s",
+             tmp_file_name.c_str());
+        unlink(tmp_file_name.c_str());
+        return;
+    }
 
 #ifdef BONES_DIAGNOSTICS
     if (do_diagnostics)
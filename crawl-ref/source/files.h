@@ -7,11 +7,13 @@
 #define FILES_H
 
 #include <cstdio>
+#include <memory>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+struct crawl_environment;
 struct player_save_info;
 
 enum load_mode_type
@@ -66,6 +68,8 @@ bool check_mkdir(const string &what, string *dir, bool silent = false);
 // Find saved games for all game types.
 vector<player_save_info> find_all_saved_characters();
 
+void unlink_save_info_cache(const string &save_path);
+
 string get_save_filename(const string &name);
 string get_savedir_filename(const string &name);
 string savedir_versioned_path(const string &subdirs = "");
@@ -96,12 +100,20 @@ bool restore_game(const string& filename);
 
 bool is_existing_level(const level_id &level);
 
+bool pregenerate_level(const level_id &dest);
+void pregenerate_next_level();
+
 class level_excursion
 {
 protected:
     level_id original;
     bool ever_changed_levels;
 
+    // The original level's environment, parked when the excursion first
+    // leaves it. Returning moves it back wholesale instead of
+    // deserializing the level from the save. See go_to().
+    unique_ptr<crawl_environment> parked;
+
 public:
     level_excursion();
     ~level_excursion();
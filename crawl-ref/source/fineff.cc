@@ -32,6 +32,31 @@
 #include "view.h"
 #include "viewchar.h"
 
+// Storage recycling for fineffs. They're scheduled in bursts during
+// melee exchanges and all freed again by fire_final_effects() before
+// the move ends, so keep freed blocks on per-size free lists instead
+// of round-tripping through the heap allocator for every hit.
+static map<size_t, vector<void *>> _fineff_pool;
+
+void *final_effect::operator new(size_t size)
+{
+    vector<void *> &pool = _fineff_pool[size];
+    if (!pool.empty())
+    {
+        void *block = pool.back();
+        pool.pop_back();
+        return block;
+    }
+    return ::operator new(size);
+}
+
+void final_effect::operator delete(void *ptr, size_t size)
+{
+    // The pool's high-water mark is the most fineffs ever pending at
+    // once, so hanging on to the blocks is cheap.
+    _fineff_pool[size].push_back(ptr);
+}
+
 /*static*/ void final_effect::schedule(final_effect *eff)
 {
     for (auto fe : env.final_effects)
@@ -14,6 +14,12 @@ class final_effect
 public:
     virtual ~final_effect() {}
 
+    // fineffs are scheduled in bursts during melee exchanges and all
+    // freed again by fire_final_effects() the same move, so their
+    // storage is recycled through free lists (see fineff.cc).
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr, size_t size);
+
     virtual bool mergeable(const final_effect &a) const = 0;
     virtual void merge(const final_effect &a)
     {
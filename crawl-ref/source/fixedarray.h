@@ -80,6 +80,27 @@ public:
             col.init(def);
     }
 
+    // ----- Whole-plane operations -----
+    // Each column is one contiguous run of HEIGHT elements, so these
+    // lower to flat loops the optimiser can unroll or vectorise, unlike
+    // the same scan phrased through a coordinate iterator.
+    int count(const TYPE& val) const
+    {
+        int n = 0;
+        for (int x = 0; x < WIDTH; ++x)
+            n += ::count(&mData[x][0], &mData[x][0] + HEIGHT, val);
+        return n;
+    }
+
+    template<class pred>
+    int count_if(pred p) const
+    {
+        int n = 0;
+        for (int x = 0; x < WIDTH; ++x)
+            n += ::count_if(&mData[x][0], &mData[x][0] + HEIGHT, p);
+        return n;
+    }
+
 protected:
     FixedVector<Column, WIDTH> mData;
 };
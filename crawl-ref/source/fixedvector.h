@@ -49,7 +49,7 @@ public:
     // ----- Access -----
     TYPE& operator[](unsigned long index)
     {
-#ifdef ASSERTS
+#ifdef HOT_ASSERTS
         if (index >= SIZE)
         {
             // Intentionally printed as signed, it's very, very unlikely we'd
@@ -57,18 +57,22 @@ public:
             die_noline("range check error (%ld / %d)", (signed long)index,
                 SIZE);
         }
+#else
+        ASSERT_HOT(index < SIZE);
 #endif
         return mData[index];
     }
 
     const TYPE& operator[](unsigned long index) const
     {
-#ifdef ASSERTS
+#ifdef HOT_ASSERTS
         if (index >= SIZE)
         {
             die_noline("range check error (%ld / %d)", (signed long)index,
                 SIZE);
         }
+#else
+        ASSERT_HOT(index < SIZE);
 #endif
         return mData[index];
     }
@@ -42,6 +42,7 @@ FTFontWrapper::FTFontWrapper() :
     m_glyphs_lru(0),
     m_glyphs_mru(0),
     m_glyphs_top(0),  // reinitialised to 1 in load_font
+    m_atlas_gen(0),
     m_max_advance(0, 0),
     m_min_offset(0),
     charsz(1,1),
@@ -56,6 +57,8 @@ FTFontWrapper::~FTFontWrapper()
     delete[] m_glyphs;
     delete[] pixels;
     delete m_buf;
+    for (const TextRun &run : m_runs)
+        delete run.buf;
 }
 
 bool FTFontWrapper::load_font(const char *font_name, unsigned int font_size,
@@ -305,6 +308,9 @@ unsigned int FTFontWrapper::map_unicode(ucs_t uchar)
             // move lru on to next
             m_glyphs_lru = m_glyphs[c].next;
             m_glyphs[m_glyphs_lru].prev = 0;
+            // quads packed against the old contents of this slot are
+            // now stale
+            m_atlas_gen++;
         }
         else // glyph data is not full
         {
@@ -389,68 +395,125 @@ void FTFontWrapper::render_textblock(unsigned int x_pos, unsigned int y_pos,
     {
         for (unsigned int x = 0; x < width; x++)
         {
-            unsigned int c = map_unicode(chars[i]);
-            uint8_t col_bg = colours[i] >> 4;
-            uint8_t col_fg = colours[i] & 0xF;
+            pack_glyph(*m_buf, adv, chars[i], colours[i], texcoord_dy);
+            i++;
 
-            if (col_bg != 0)
+            // See if we need to flush prematurely.
+            if (n_subst == MAX_GLYPHS - 1)
             {
-                GLWPrim rect(adv.x, adv.y,
-                             adv.x + m_max_advance.x, adv.y + m_max_advance.y);
-                // Leave tex coords at their default 0.0f
-                VColour col(term_colours[col_bg].r,
-                            term_colours[col_bg].g,
-                            term_colours[col_bg].b);
-                rect.set_col(col);
-                m_buf->add(rect);
+                draw_m_buf(x_pos, y_pos, drop_shadow);
+                m_buf->clear();
+                n_subst = 0;
             }
+        }
 
-            adv.x += m_glyphs[c].offset;
+        adv.x = 0;
+        adv.y += m_max_advance.y;
+    }
 
-            if (m_glyphs[c].renderable)
-            {
-                int this_width = m_glyphs[c].width;
+    draw_m_buf(x_pos, y_pos, drop_shadow);
+}
+
+// Append the background and glyph quads for one cell to buf, advancing
+// the pen position.
+void FTFontWrapper::pack_glyph(GLShapeBuffer &buf, coord_def &adv, ucs_t ch,
+                               uint8_t colour, float texcoord_dy)
+{
+    unsigned int c = map_unicode(ch);
+    uint8_t col_bg = colour >> 4;
+    uint8_t col_fg = colour & 0xF;
 
-                float tex_x = (float)(c % GLYPHS_PER_ROWCOL) / (float)GLYPHS_PER_ROWCOL;
-                float tex_y = (float)(c / GLYPHS_PER_ROWCOL) / (float)GLYPHS_PER_ROWCOL;
-                float tex_x2 = tex_x + (float)this_width / (float)m_tex.width();
-                float tex_y2 = tex_y + texcoord_dy;
+    if (col_bg != 0)
+    {
+        GLWPrim rect(adv.x, adv.y,
+                     adv.x + m_max_advance.x, adv.y + m_max_advance.y);
+        // Leave tex coords at their default 0.0f
+        VColour col(term_colours[col_bg].r,
+                    term_colours[col_bg].g,
+                    term_colours[col_bg].b);
+        rect.set_col(col);
+        buf.add(rect);
+    }
 
-                GLWPrim rect(adv.x, adv.y - m_glyphs[c].ascender + m_ascender,
-                             adv.x + this_width, adv.y + m_max_height - m_glyphs[c].ascender + m_ascender);
+    adv.x += m_glyphs[c].offset;
 
-                VColour col(term_colours[col_fg].r,
-                            term_colours[col_fg].g,
-                            term_colours[col_fg].b);
-                rect.set_col(col);
-                rect.set_tex(tex_x, tex_y, tex_x2, tex_y2);
+    if (m_glyphs[c].renderable)
+    {
+        int this_width = m_glyphs[c].width;
 
-                m_buf->add(rect);
-            }
+        float tex_x = (float)(c % GLYPHS_PER_ROWCOL) / (float)GLYPHS_PER_ROWCOL;
+        float tex_y = (float)(c / GLYPHS_PER_ROWCOL) / (float)GLYPHS_PER_ROWCOL;
+        float tex_x2 = tex_x + (float)this_width / (float)m_tex.width();
+        float tex_y2 = tex_y + texcoord_dy;
+
+        GLWPrim rect(adv.x, adv.y - m_glyphs[c].ascender + m_ascender,
+                     adv.x + this_width,
+                     adv.y + m_max_height - m_glyphs[c].ascender + m_ascender);
 
+        VColour col(term_colours[col_fg].r,
+                    term_colours[col_fg].g,
+                    term_colours[col_fg].b);
+        rect.set_col(col);
+        rect.set_tex(tex_x, tex_y, tex_x2, tex_y2);
+
+        buf.add(rect);
+    }
+
+    adv.x += m_glyphs[c].advance - m_glyphs[c].offset;
+}
+
+bool FTFontWrapper::pack_textblock(GLShapeBuffer &buf, const ucs_t *chars,
+                                   const uint8_t *colours, unsigned int width,
+                                   unsigned int height)
+{
+    buf.clear();
+
+    if (!chars || !colours || !width || !height || !m_glyphs)
+        return false;
+
+    coord_def adv(max(-m_min_offset, 0), 0);
+    unsigned int i = 0;
+    n_subst = 0;
+
+    float texcoord_dy = (float)m_max_height / (float)m_tex.height();
+    for (unsigned int y = 0; y < height; y++)
+    {
+        for (unsigned int x = 0; x < width; x++)
+        {
+            pack_glyph(buf, adv, chars[i], colours[i], texcoord_dy);
             i++;
-            adv.x += m_glyphs[c].advance - m_glyphs[c].offset;
 
-            // See if we need to flush prematurely.
+            // The atlas cycled within this one block, so quads already
+            // packed may reference reused slots: this block can't be
+            // drawn in a single batch.
             if (n_subst == MAX_GLYPHS - 1)
-            {
-                draw_m_buf(x_pos, y_pos, drop_shadow);
-                m_buf->clear();
-                n_subst = 0;
-            }
+                return false;
         }
 
         adv.x = 0;
         adv.y += m_max_advance.y;
     }
 
-    draw_m_buf(x_pos, y_pos, drop_shadow);
+    return true;
+}
+
+unsigned int FTFontWrapper::atlas_generation() const
+{
+    return m_atlas_gen;
 }
 
 void FTFontWrapper::draw_m_buf(unsigned int x_pos, unsigned int y_pos,
                                bool drop_shadow)
 {
-    if (!m_buf->size())
+    draw_textblock_buffer(*m_buf, x_pos, y_pos, drop_shadow);
+}
+
+void FTFontWrapper::draw_textblock_buffer(GLShapeBuffer &buf,
+                                          unsigned int x_pos,
+                                          unsigned int y_pos,
+                                          bool drop_shadow)
+{
+    if (!buf.size())
         return;
 
     GLState state;
@@ -475,11 +538,11 @@ void FTFontWrapper::draw_m_buf(unsigned int x_pos, unsigned int y_pos,
         GLW_3VF trans_shadow(trans.x + 1, trans.y + 1, 0.0f);
         glmanager->set_transform(trans_shadow, scale);
 
-        m_buf->draw(state_shadow);
+        buf.draw(state_shadow);
     }
 
     glmanager->set_transform(trans, scale);
-    m_buf->draw(state);
+    buf.draw(state);
 
     glmanager->reset_transform();
 }
@@ -634,6 +697,62 @@ formatted_string FTFontWrapper::split(const formatted_string &str,
     return ret;
 }
 
+// How many packed render_string runs to keep. Tooltips and the message
+// pane's alt text redraw the same few strings every frame.
+static const unsigned int MAX_TEXT_RUNS = 16;
+
+FTFontWrapper::TextRun *FTFontWrapper::find_text_run(const string &key)
+{
+    for (unsigned int i = 0; i < m_runs.size(); ++i)
+    {
+        if (m_runs[i].key != key)
+            continue;
+
+        if (m_runs[i].generation != m_atlas_gen)
+        {
+            // A glyph this run may use was evicted; repack.
+            delete m_runs[i].buf;
+            m_runs.erase(m_runs.begin() + i);
+            return nullptr;
+        }
+
+        if (i > 0)
+            rotate(m_runs.begin(), m_runs.begin() + i, m_runs.begin() + i + 1);
+        return &m_runs[0];
+    }
+    return nullptr;
+}
+
+FTFontWrapper::TextRun *FTFontWrapper::add_text_run(const string &key,
+                                                    const ucs_t *chars,
+                                                    const uint8_t *colours,
+                                                    unsigned int width,
+                                                    unsigned int height,
+                                                    int wx, int wy)
+{
+    TextRun run;
+    run.key = key;
+    run.wx = wx;
+    run.wy = wy;
+    run.buf = GLShapeBuffer::create(true, true);
+    if (!pack_textblock(*run.buf, chars, colours, width, height))
+    {
+        // The block cycled the whole atlas; not representable as a
+        // single cached run.
+        delete run.buf;
+        return nullptr;
+    }
+    run.generation = m_atlas_gen;
+
+    if (m_runs.size() >= MAX_TEXT_RUNS)
+    {
+        delete m_runs.back().buf;
+        m_runs.pop_back();
+    }
+    m_runs.insert(m_runs.begin(), run);
+    return &m_runs[0];
+}
+
 void FTFontWrapper::render_string(unsigned int px, unsigned int py,
                                   const char *text,
                                   const coord_def &min_pos,
@@ -668,39 +787,52 @@ void FTFontWrapper::render_string(unsigned int px, unsigned int py,
         }
     }
 
-    // Create the text block
-    ucs_t *chars = (ucs_t*)malloc(max_rows * max_cols * sizeof(ucs_t));
-    uint8_t *colours = (uint8_t*)malloc(max_rows * max_cols);
-    for (unsigned int i = 0; i < max_rows * max_cols; i++)
-        chars[i] = ' ';
-    memset(colours, font_colour, max_rows * max_cols);
+    // Tooltips and similar callers redraw the same string every frame;
+    // reuse the packed quads if we have them.
+    const string key = string(text) + '\x1f' + char(font_colour);
+    TextRun *run = find_text_run(key);
 
-    // Fill the text block
-    cols = 0;
-    unsigned int rows = 0;
-    for (const char *tp = text; int s = utf8towc(&c, tp); tp += s)
+    ucs_t *chars = nullptr;
+    uint8_t *colours = nullptr;
+    if (!run)
     {
-        int w = wcwidth(c);
-        if (w > 0) // FIXME: combining characters are silently ignored
+        // Create the text block
+        chars = (ucs_t*)malloc(max_rows * max_cols * sizeof(ucs_t));
+        colours = (uint8_t*)malloc(max_rows * max_cols);
+        for (unsigned int i = 0; i < max_rows * max_cols; i++)
+            chars[i] = ' ';
+        memset(colours, font_colour, max_rows * max_cols);
+
+        // Fill the text block
+        cols = 0;
+        unsigned int rows = 0;
+        for (const char *tp = text; int s = utf8towc(&c, tp); tp += s)
         {
-            chars[cols + rows * max_cols] = c;
-            cols++;
-            if (w == 2)
-                chars[cols + rows * max_cols] = ' ', cols++;
-        }
+            int w = wcwidth(c);
+            if (w > 0) // FIXME: combining characters are silently ignored
+            {
+                chars[cols + rows * max_cols] = c;
+                cols++;
+                if (w == 2)
+                    chars[cols + rows * max_cols] = ' ', cols++;
+            }
 
-        if (c == '\n')
-        {
-            cols = 0;
-            rows++;
+            if (c == '\n')
+            {
+                cols = 0;
+                rows++;
+            }
         }
+
+        run = add_text_run(key, chars, colours, max_cols, max_rows,
+                           string_width(text), max_rows * char_height());
     }
 
     // Find a suitable location on screen
     const int buffer = 5;  // additional buffer size from edges
 
-    int wx = string_width(text);
-    int wy = max_rows * char_height();
+    int wx = run ? run->wx : (int)string_width(text);
+    int wy = run ? run->wy : (int)(max_rows * char_height());
 
     int sx, sy; // box starting location, uses extra buffer
     int tx, ty; // text starting location
@@ -736,7 +868,11 @@ void FTFontWrapper::render_string(unsigned int px, unsigned int py,
     if (box_alpha != 0)
         _draw_box(tx, ty, wx, wy, outline, box_colour, box_alpha);
 
-    render_textblock(tx, ty, chars, colours, max_cols, max_rows, drop_shadow);
+    if (run)
+        draw_textblock_buffer(*run->buf, tx, ty, drop_shadow);
+    else
+        render_textblock(tx, ty, chars, colours, max_cols, max_rows,
+                         drop_shadow);
 
     free(chars);
     free(colours);
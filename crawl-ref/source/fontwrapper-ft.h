@@ -34,6 +34,16 @@ public:
                                   unsigned int width, unsigned int height,
                                   bool drop_shadow = false) override;
 
+    virtual bool pack_textblock(GLShapeBuffer &buf, const ucs_t *chars,
+                                const uint8_t *colours, unsigned int width,
+                                unsigned int height) override;
+
+    virtual void draw_textblock_buffer(GLShapeBuffer &buf, unsigned int x,
+                                       unsigned int y,
+                                       bool drop_shadow = false) override;
+
+    virtual unsigned int atlas_generation() const override;
+
     // render text + background box
     virtual void render_string(unsigned int x, unsigned int y,
                                const char *text, const coord_def &min_pos,
@@ -78,10 +88,27 @@ protected:
 
     int find_index_before_width(const char *str, int max_width);
 
+    // A packed quad run for one render_string call, reusable while the
+    // glyph atlas generation is unchanged.
+    struct TextRun
+    {
+        string key;              // text plus colour
+        unsigned int generation; // m_atlas_gen when packed
+        int wx, wy;              // pixel extent, for box placement
+        GLShapeBuffer *buf;
+    };
+
+    TextRun *find_text_run(const string &key);
+    TextRun *add_text_run(const string &key, const ucs_t *chars,
+                          const uint8_t *colours, unsigned int width,
+                          unsigned int height, int wx, int wy);
+
     unsigned int map_unicode(ucs_t uchar, bool update);
     unsigned int map_unicode(ucs_t uchar);
     void load_glyph(unsigned int c, ucs_t uchar);
     void draw_m_buf(unsigned int x_pos, unsigned int y_pos, bool drop_shadow);
+    void pack_glyph(GLShapeBuffer &buf, coord_def &adv, ucs_t ch,
+                    uint8_t colour, float texcoord_dy);
 
     struct GlyphInfo
     {
@@ -120,6 +147,12 @@ protected:
     // count of glyph loads in the current text block
     int n_subst;
 
+    // bumped when an atlas slot is reused for a different glyph
+    unsigned int m_atlas_gen;
+
+    // render_string's packed runs, most recently used first
+    vector<TextRun> m_runs;
+
     // cached value of the maximum advance from m_advance
     coord_def m_max_advance;
 
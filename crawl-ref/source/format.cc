@@ -292,6 +292,21 @@ formatted_string::operator += (const formatted_string &other)
     return *this;
 }
 
+const formatted_string &
+formatted_string::operator += (formatted_string &&other)
+{
+    if (ops.empty())
+        ops = move(other.ops);
+    else
+    {
+        ops.reserve(ops.size() + other.ops.size());
+        ops.insert(ops.end(), make_move_iterator(other.ops.begin()),
+                              make_move_iterator(other.ops.end()));
+    }
+    other.ops.clear();
+    return *this;
+}
+
 int formatted_string::width() const
 {
     // Just add up the individual string lengths.
@@ -471,6 +486,11 @@ bool formatted_string::empty()
     return ops.empty();
 }
 
+void formatted_string::reserve(size_t nops)
+{
+    ops.reserve(nops);
+}
+
 void formatted_string::cprintf(const char *s, ...)
 {
     va_list args;
@@ -479,9 +499,30 @@ void formatted_string::cprintf(const char *s, ...)
     va_end(args);
 }
 
+// Consecutive text ops are merged, so a run of cprintf calls (as in the
+// HUD code) grows a single string instead of allocating an op apiece.
+// Don't merge past the 999-char limit parse_string1 splits at: displaying
+// an op must stay within the console cprintf buffer.
+static bool _can_merge(const formatted_string::oplist &ops, const string &s)
+{
+    return !ops.empty() && ops.back().type == FSOP_TEXT
+           && ops.back().text.size() + s.size() < 999;
+}
+
 void formatted_string::cprintf(const string &s)
 {
-    ops.push_back(s);
+    if (_can_merge(ops, s))
+        ops.back().text += s;
+    else
+        ops.push_back(s);
+}
+
+void formatted_string::cprintf(string &&s)
+{
+    if (_can_merge(ops, s))
+        ops.back().text += s;
+    else
+        ops.push_back(move(s));
 }
 
 void formatted_string::fs_op::display() const
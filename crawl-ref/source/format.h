@@ -25,6 +25,7 @@ public:
 
     void cprintf(PRINTF(1, ));
     void cprintf(const string &s);
+    void cprintf(string &&s);
     void add_glyph(cglyph_t g);
     void textcolour(int colour);
     formatted_string chop(int length) const;
@@ -35,6 +36,7 @@ public:
 
     void clear();
     bool empty();
+    void reserve(size_t nops);
 
     void swap(formatted_string& other);
 
@@ -43,6 +45,7 @@ public:
 
     bool operator < (const formatted_string &other) const;
     const formatted_string &operator += (const formatted_string &other);
+    const formatted_string &operator += (formatted_string &&other);
     char &operator [] (size_t idx);
 
 public:
@@ -66,17 +69,21 @@ public:
     struct fs_op
     {
         fs_op_type type;
-        int x, y;
-        bool relative;
+        int x;
         string text;
 
         fs_op(int colour)
-            : type(FSOP_COLOUR), x(colour), y(-1), relative(false), text()
+            : type(FSOP_COLOUR), x(colour), text()
         {
         }
 
         fs_op(const string &s)
-            : type(FSOP_TEXT), x(-1), y(-1), relative(false), text(s)
+            : type(FSOP_TEXT), x(-1), text(s)
+        {
+        }
+
+        fs_op(string &&s)
+            : type(FSOP_TEXT), x(-1), text(move(s))
         {
         }
 
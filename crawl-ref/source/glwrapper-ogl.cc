@@ -75,9 +75,7 @@ OGLStateManager::OGLStateManager()
     glClearColor(0.0, 0.0, 0.0, 1.0f);
     glDepthFunc(GL_LEQUAL);
 
-#ifdef __ANDROID__
-    m_last_tex = 0;
-#endif
+    m_bound_texture = 0;
 }
 
 void OGLStateManager::set(const GLState& state)
@@ -241,6 +239,11 @@ void OGLStateManager::pixelstore_unpack_alignment(unsigned int bpp)
 
 void OGLStateManager::delete_textures(size_t count, unsigned int *textures)
 {
+    // A deleted texture's name can be handed out again by
+    // generate_textures, so don't let the bind cache match it.
+    for (size_t i = 0; i < count; ++i)
+        if (textures[i] == m_bound_texture)
+            m_bound_texture = 0;
     glDeleteTextures(count, (GLuint*)textures);
     glDebug("glDeleteTextures");
 }
@@ -253,11 +256,12 @@ void OGLStateManager::generate_textures(size_t count, unsigned int *textures)
 
 void OGLStateManager::bind_texture(unsigned int texture)
 {
+    if (texture == m_bound_texture)
+        return;
+
     glBindTexture(GL_TEXTURE_2D, texture);
     glDebug("glBindTexture");
-#ifdef __ANDROID__
-    m_last_tex = texture;
-#endif
+    m_bound_texture = texture;
 }
 
 void OGLStateManager::load_texture(unsigned char *pixels, unsigned int width,
@@ -335,7 +339,7 @@ void OGLStateManager::fixup_gl_state()
     glDepthFunc(GL_LEQUAL);
 
     glEnable(GL_TEXTURE_2D);
-    glBindTexture(GL_TEXTURE_2D, m_last_tex);
+    glBindTexture(GL_TEXTURE_2D, m_bound_texture);
     glDebug("glBindTexture (REBIND)");
     glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
     glDebug("glTexEnvf (REBIND)");
@@ -34,9 +34,10 @@ public:
                               int xoffset=-1, int yoffset=-1) override;
 protected:
     GLState m_current_state;
-#ifdef __ANDROID__
-    GLint m_last_tex;
-#endif
+    // The texture currently bound, so redundant glBindTexture calls can
+    // be skipped: the dungeon cell buffers draw several buffers sharing
+    // a texture back to back every frame.
+    unsigned int m_bound_texture;
 
 private:
     void glDebug(const char* msg);
@@ -771,6 +771,24 @@ bool zin_check_able_to_recite(bool quiet)
  */
 int zin_check_recite_to_monsters(bool quiet)
 {
+    // The ability menu and the ability itself can both ask in one turn,
+    // and each scan walks every cell in sight. The answer only changes
+    // when monster state does -- enchantments (including the recite
+    // timer), attitude, movement, deaths -- all of which bump the
+    // tension cache epoch, or when recite power shifts the too-strong
+    // threshold.
+    static int cached_epoch = -1;
+    static int cached_time = -1;
+    static int cached_power = -1;
+    static int cached_result = 0;
+
+    const int power = zin_recite_power();
+    if (tension_cache_epoch() == cached_epoch
+        && you.elapsed_time == cached_time && power == cached_power)
+    {
+        return cached_result;
+    }
+
     bool found_temp_ineligible = false;
     bool found_eligible = false;
 
@@ -795,20 +813,26 @@ int zin_check_recite_to_monsters(bool quiet)
         }
     }
 
+    cached_epoch = tension_cache_epoch();
+    cached_time = you.elapsed_time;
+    cached_power = power;
+
     if (!found_eligible && !found_temp_ineligible)
     {
         if (!quiet)
             dprf("No audience found!");
-        return 0;
+        cached_result = 0;
     }
     else if (!found_eligible && found_temp_ineligible)
     {
         if (!quiet)
             dprf("No sensible audience found!");
-        return -1;
+        cached_result = -1;
     }
     else
-        return 1; // We just recite against everything.
+        cached_result = 1; // We just recite against everything.
+
+    return cached_result;
 }
 
 enum zin_eff
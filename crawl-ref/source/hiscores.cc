@@ -90,12 +90,21 @@ static string _log_file_name()
     return Options.shared_dir + "logfile" + crawl_state.game_type_qualifier();
 }
 
+// Returns the sc= field of a raw xlogfile line. Finding the insertion
+// point for a new score needs only this one field, so don't pay for a
+// full scorefile_entry decode (species, branch, kill source...) of up
+// to SCORE_FILE_ENTRIES entries while the death sequence holds the
+// scorefile lock. Lines that can't be parsed sort below any real score.
+static int _raw_line_score(const string &line)
+{
+    return xlog_fields(line).int_field("sc");
+}
+
 int hiscores_new_entry(const scorefile_entry &ne)
 {
     unwind_bool score_update(crawl_state.updating_scores, true);
 
     FILE *scores;
-    int i, total_entries;
     bool inserted = false;
     int newest_entry = -1;
 
@@ -110,39 +119,30 @@ int hiscores_new_entry(const scorefile_entry &ne)
     // we're at the end of the file, seek back to beginning.
     fseek(scores, 0, SEEK_SET);
 
-    // read highscore file, inserting new entry at appropriate point,
-    for (i = 0; i < SCORE_FILE_ENTRIES; i++)
+    // Read the raw scorefile lines, splicing the new entry in at the
+    // appropriate point. The existing entries pass through untouched.
+    vector<string> lines;
+    char inbuf[1300];
+    while (fgets(inbuf, sizeof inbuf, scores))
     {
-        hs_list[i].reset(new scorefile_entry);
-        if (_hs_read(scores, *hs_list[i]) == false)
-            break;
-
-        // compare points..
-        if (!inserted && ne.get_score() >= hs_list[i]->get_score())
+        if (!inserted && ne.get_score() >= _raw_line_score(inbuf))
         {
-            newest_entry = i;           // for later printing
+            newest_entry = lines.size();    // for later printing
             inserted = true;
-            // copy read entry to i+1th position
-            // Fixed a nasty overflow bug here -- Sharp
-            if (i+1 < SCORE_FILE_ENTRIES)
-            {
-                hs_list[i + 1] = move(hs_list[i]);
-                hs_list[i].reset(new scorefile_entry(ne));
-                i++;
-            }
-            else
-                *hs_list[i] = ne; // copy new entry to current position
+            lines.push_back(ne.raw_string());
         }
+
+        if ((int)lines.size() >= SCORE_FILE_ENTRIES)
+            break;
+        lines.push_back(inbuf);
     }
 
     // special case: lowest score, with room
-    if (!inserted && i < SCORE_FILE_ENTRIES)
+    if (!inserted && (int)lines.size() < SCORE_FILE_ENTRIES)
     {
-        newest_entry = i;
+        newest_entry = lines.size();
         inserted = true;
-        // copy new entry
-        hs_list[i].reset(new scorefile_entry(ne));
-        i++;
+        lines.push_back(ne.raw_string());
     }
 
     // If we've still not inserted it, it's not a highscore.
@@ -152,8 +152,6 @@ int hiscores_new_entry(const scorefile_entry &ne)
         return -1;
     }
 
-    total_entries = i;
-
     // The old code closed and reopened the score file, leading to a
     // race condition where one Crawl process could overwrite the
     // other's highscore. Now we truncate and rewrite the file without
@@ -164,11 +162,8 @@ int hiscores_new_entry(const scorefile_entry &ne)
     rewind(scores);
 
     // write scorefile entries.
-    for (i = 0; i < total_entries; i++)
-    {
-        _hs_write(scores, *hs_list[i]);
-        hs_list[i].reset(nullptr);
-    }
+    for (const string &line : lines)
+        fprintf(scores, "%s", line.c_str());
 
     // close scorefile.
     _hs_close(scores, _score_file_name());
@@ -17,6 +17,7 @@
 #include <cctype>
 #include <cstdio>
 #include <cstdlib>
+#include <map>
 #include <set>
 #include <string>
 
@@ -31,6 +32,7 @@
 #include "errors.h"
 #include "files.h"
 #include "invent.h"
+#include "itemname.h"
 #include "itemprop.h"
 #include "items.h"
 #include "jobs.h"
@@ -1085,6 +1087,7 @@ void game_options::reset_options()
     tile_display_mode = "tiles";
     tile_level_map_hide_messages = true;
     tile_level_map_hide_sidebar = false;
+    tile_web_idle_save_time = 0;
 #endif
 
     // map each colour to itself as default
@@ -1540,10 +1543,60 @@ static const char* config_defaults[] =
     "defaults/misc.txt",
 };
 
+// Decoded lines of an rc or included option file, kept so that the
+// defaults/*.txt files and unchanged rcs are read from disk only once
+// per process rather than for every new game. The mtime is checked on
+// each use, so editing a file between games still takes effect. Only
+// the raw lines are cached: option lines can run Lua and have side
+// effects (includes, keybindings, macro_save), so the parse itself must
+// be repeated.
+struct cached_rc_file
+{
+    time_t mtime;
+    vector<string> lines;
+};
+static map<string, cached_rc_file> _rc_file_cache;
+
+// Replays lines captured by _get_rc_file_lines.
+class CachedLineInput : public LineInput
+{
+public:
+    CachedLineInput(const vector<string> &_lines) : lines(_lines), pos(0) { }
+    bool eof() override { return pos >= lines.size(); }
+    string get_line() override { return eof() ? "" : lines[pos++]; }
+private:
+    const vector<string> &lines;
+    size_t pos;
+};
+
+// Returns the (possibly cached) lines of the given option file, or
+// nullptr if it can't be read.
+static const vector<string> *_get_rc_file_lines(const string &file)
+{
+    const time_t mtime = file_modtime(file);
+    auto cached = _rc_file_cache.find(file);
+    if (cached != _rc_file_cache.end() && cached->second.mtime == mtime)
+        return &cached->second.lines;
+
+    FileLineInput f(file.c_str());
+    if (f.error())
+        return nullptr;
+
+    cached_rc_file &entry = _rc_file_cache[file];
+    entry.mtime = mtime;
+    entry.lines.clear();
+    while (!f.eof())
+        entry.lines.push_back(f.get_line());
+    return &entry.lines;
+}
+
 void read_init_file(bool runscript)
 {
     Options.reset_options();
 
+    // Generated names depend on options (e.g. show_uncursed).
+    clear_item_name_cache();
+
     // Load Lua builtins.
 #ifdef CLUA_BINDINGS
     if (runscript)
@@ -1577,7 +1630,7 @@ void read_init_file(bool runscript)
     // Load init.txt.
     const string init_file_name(find_crawlrc());
 
-    FileLineInput f(init_file_name.c_str());
+    const vector<string> *init_lines = _get_rc_file_lines(init_file_name);
 
     Options.filename = init_file_name;
     Options.line_num = 0;
@@ -1587,8 +1640,9 @@ void read_init_file(bool runscript)
     Options.basefilename = "init.txt";
 #endif
 
-    if (f.error())
+    if (!init_lines)
         return;
+    CachedLineInput f(*init_lines);
     Options.read_options(f, runscript);
 
     if (Options.read_persist_options)
@@ -3834,6 +3888,7 @@ void game_options::read_option_line(const string &str, bool runscript)
     }
     else BOOL_OPTION(tile_level_map_hide_messages);
     else BOOL_OPTION(tile_level_map_hide_sidebar);
+    else INT_OPTION(tile_web_idle_save_time, 0, INT_MAX);
 #endif
 #endif // USE_TILE
 
@@ -4129,9 +4184,11 @@ void game_options::include(const string &rawfilename, bool resolve,
     // Also unwind any aliases defined in included files.
     unwind_var<string_map> unwalias(aliases);
 
-    FileLineInput fl(include_file.c_str());
-    if (!fl.error())
+    if (const vector<string> *lines = _get_rc_file_lines(include_file))
+    {
+        CachedLineInput fl(*lines);
         read_options(fl, runscript, false);
+    }
 }
 
 void game_options::report_error(const char* format, ...)
@@ -4248,6 +4305,8 @@ enum commandline_option_type
     CLO_THROTTLE,
     CLO_NO_THROTTLE,
     CLO_PLAYABLE_JSON, // JSON metadata for species, jobs, combos.
+    CLO_RECORD,
+    CLO_REPLAY,
 #ifdef USE_TILE_WEB
     CLO_WEBTILES_SOCKET,
     CLO_AWAIT_CONNECTION,
@@ -4266,7 +4325,7 @@ static const char *cmd_ops[] =
     "extra-opt-first", "extra-opt-last", "sprint-map", "edit-save",
     "print-charset", "tutorial", "wizard", "explore", "no-save",
     "gdb", "no-gdb", "nogdb", "throttle", "no-throttle",
-    "playable-json",
+    "playable-json", "record", "replay",
 #ifdef USE_TILE_WEB
     "webtiles-socket", "await-connection", "print-webtiles-options",
 #endif
@@ -5044,6 +5103,20 @@ bool parse_args(int argc, char **argv, bool rc_only)
             nextUsed = true;
             break;
 
+        case CLO_RECORD:
+            if (!next_is_param)
+                return false;
+            crawl_state.journal_record = next_arg;
+            nextUsed = true;
+            break;
+
+        case CLO_REPLAY:
+            if (!next_is_param)
+                return false;
+            crawl_state.journal_replay = next_arg;
+            nextUsed = true;
+            break;
+
         case CLO_SPRINT:
             if (!rc_only)
                 Options.game.type = GAME_TYPE_SPRINT;
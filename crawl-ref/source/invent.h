@@ -114,7 +114,17 @@ public:
 
     virtual int highlight_colour() const override
     {
-        return menu_colour(get_text(), item_prefix(*item), tag);
+        // This runs for every line on every menu redraw, and the item
+        // prefix walk plus the menu_colour regexes are far too heavy for
+        // that. Neither the text nor the item changes while the menu is
+        // up, so compute the colour once per entry.
+        if (!colour_calculated)
+        {
+            calculated_colour = menu_colour(get_text(), item_prefix(*item),
+                                            tag);
+            colour_calculated = true;
+        }
+        return calculated_colour;
     }
 
     virtual void select(int qty = -1) override;
@@ -127,6 +137,9 @@ public:
 
 private:
     void add_class_hotkeys(const item_def &i);
+
+    mutable bool colour_calculated = false;
+    mutable int  calculated_colour = -1;
 };
 
 class InvMenu : public Menu
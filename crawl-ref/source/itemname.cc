@@ -48,6 +48,7 @@
 #include "skills.h"
 #include "spl-book.h"
 #include "spl-summoning.h"
+#include "stash.h"
 #include "state.h"
 #include "stringutil.h"
 #include "throw.h"
@@ -129,6 +130,45 @@ static string _item_inscription(const item_def &item)
                                              ", ").c_str());
 }
 
+// Memo table for item_def::name(). Name generation walks name_aux()'s
+// branching and several database lookups every call; for the plain items
+// that make up nearly every query the result is a pure function of the
+// fields keyed below plus global type identification, so it can be
+// reused. Items whose names read props (artefacts, corpses, decks and
+// other miscellany) are never cached. clear_item_name_cache() must be
+// called when item knowledge changes under our feet.
+static map<string, string> _name_cache;
+
+void clear_item_name_cache()
+{
+    _name_cache.clear();
+}
+
+static bool _name_cacheable(const item_def &item)
+{
+    return !is_artefact(item)
+           && item.base_type != OBJ_CORPSES
+           && item.base_type != OBJ_MISCELLANY
+           && item.base_type != OBJ_ORBS
+           // Damnation bolts, supercharged rods, ... name from props.
+           && item.props.empty();
+}
+
+static string _name_cache_key(const item_def &item,
+                              description_level_type descrip, bool terse,
+                              bool ident, bool with_inscription,
+                              bool quantity_in_words, iflags_t ignore_flags)
+{
+    return make_stringf("%d:%d:%d:%d:%d:%u:%d:%u:%d:%d:%d:%d%d%d%d:%u:%s",
+                        item.base_type, item.sub_type, item.plus, item.plus2,
+                        item.special, item.rnd, item.quantity,
+                        unsigned(item.flags), item.link,
+                        in_inventory(item) ? 1 : 0,
+                        descrip, terse, ident, with_inscription,
+                        quantity_in_words, unsigned(ignore_flags),
+                        item.inscription.c_str());
+}
+
 string item_def::name(description_level_type descrip, bool terse, bool ident,
                       bool with_inscription, bool quantity_in_words,
                       iflags_t ignore_flags) const
@@ -142,6 +182,18 @@ string item_def::name(description_level_type descrip, bool terse, bool ident,
     if (descrip == DESC_NONE)
         return "";
 
+    string cache_key;
+    // DESC_INVENTORY_EQUIP names read equipment, quiver and meld state.
+    if (descrip != DESC_INVENTORY_EQUIP && _name_cacheable(*this))
+    {
+        cache_key = _name_cache_key(*this, descrip, terse, ident,
+                                    with_inscription, quantity_in_words,
+                                    ignore_flags);
+        auto cached = _name_cache.find(cache_key);
+        if (cached != _name_cache.end())
+            return cached->second;
+    }
+
     ostringstream buff;
 
     const string auxname = name_aux(descrip, terse, ident, with_inscription,
@@ -318,7 +370,16 @@ string item_def::name(description_level_type descrip, bool terse, bool ident,
         buff << " (curse)";
     }
 
-    return buff.str();
+    const string result = buff.str();
+    if (!cache_key.empty())
+    {
+        // Crude bound; a full game's worth of distinct names stays well
+        // under this.
+        if (_name_cache.size() > 4096)
+            _name_cache.clear();
+        _name_cache[cache_key] = result;
+    }
+    return result;
 }
 
 static bool _missile_brand_is_prefix(special_missile_type brand)
@@ -2244,6 +2305,9 @@ bool set_ident_type(item_def &item, bool identify)
 bool set_ident_type(object_class_type basetype, int subtype, bool identify)
 {
     preserve_quiver_slots p;
+    // Collect shopping-list repricing across this identification and any
+    // identify-by-elimination it triggers; see shoplist_ident_batch.
+    shoplist_ident_batch ident_batch;
 
     if (!item_type_has_ids(basetype))
         return false;
@@ -2258,6 +2322,10 @@ bool set_ident_type(object_class_type basetype, int subtype, bool identify)
     // prices.
     shopping_list.item_type_identified(basetype, subtype);
 
+    // ... and the names of any stashed items of this type.
+    invalidate_stash_search_cache();
+    clear_item_name_cache();
+
     // We identified something, maybe we identified other things by process of
     // elimination.
     if (identify && !(you.pending_revival || crawl_state.updating_scores))
@@ -2490,6 +2558,9 @@ public:
         // Set the force_autopickup values
         const int forceval = (selected_qty == 2 ? -1 : selected_qty);
         you.force_autopickup[item->base_type][item->sub_type] = forceval;
+
+        // Stash search annotations include autopickup status.
+        invalidate_stash_search_cache();
     }
 };
 
@@ -111,6 +111,8 @@ void display_runes();
 string quant_name(const item_def &item, int quant,
                   description_level_type des, bool terse = false);
 
+void clear_item_name_cache();
+
 bool item_type_known(const item_def &item);
 bool item_type_unknown(const item_def &item);
 bool item_type_known(const object_class_type base_type, const int sub_type);
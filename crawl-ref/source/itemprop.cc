@@ -775,6 +775,25 @@ bool item_type_removed(object_class_type base, int subtype)
     return removed_items.count({ base, subtype }) != 0;
 }
 
+// Uniformly pick a subtype in [first, last] that hasn't been removed.
+// Equivalent to rerolling random subtypes until one passes
+// item_type_removed(), but done as a single draw: removed_items is
+// fixed at compile time, so the list of survivors for each range is
+// built once on first use.
+int random_subtype_not_removed(object_class_type base, int first, int last)
+{
+    static map<pair<pair<int, int>, int>, vector<int>> all_survivors;
+    vector<int> &survivors = all_survivors[{ { base, first }, last }];
+    if (survivors.empty())
+    {
+        for (int subtype = first; subtype <= last; subtype++)
+            if (!item_type_removed(base, subtype))
+                survivors.push_back(subtype);
+        ASSERT(!survivors.empty());
+    }
+    return survivors[random2(survivors.size())];
+}
+
 // Some convenient functions to hide the bit operations and create
 // an interface layer between the code and the data in case this
 // gets changed again. - bwr
@@ -494,6 +494,19 @@ void init_item(int item)
     mitm[item].clear();
 }
 
+// Item slots released by destroy_item() since the last full scan.
+// Entries are revalidated before use, so slots recycled behind our back
+// (level loads replace mitm wholesale) are dropped harmlessly; when the
+// list runs dry, get_mitm_slot() falls back to the old scan and
+// restocks it from what the scan walks past anyway.
+static vector<int> _free_mitm_slots;
+
+static void _note_free_mitm_slot(int idx)
+{
+    if (idx >= 0 && idx < MAX_ITEMS)
+        _free_mitm_slots.push_back(idx);
+}
+
 // Returns an unused mitm slot, or NON_ITEM if none available.
 // The reserve is the number of item slots to not check.
 // Items may be culled if a reserve <= 10 is specified.
@@ -506,10 +519,44 @@ int get_mitm_slot(int reserve)
 
     int item = NON_ITEM;
 
+    for (int i = (int)_free_mitm_slots.size() - 1; i >= 0; i--)
+    {
+        const int slot = _free_mitm_slots[i];
+        if (mitm[slot].defined())
+        {
+            // Stale entry; the slot was reused without our knowledge.
+            _free_mitm_slots[i] = _free_mitm_slots.back();
+            _free_mitm_slots.pop_back();
+        }
+        else if (slot < MAX_ITEMS - reserve)
+        {
+            _free_mitm_slots[i] = _free_mitm_slots.back();
+            _free_mitm_slots.pop_back();
+            item = slot;
+            break;
+        }
+        // Free but inside the reserve: leave it for a later caller.
+    }
+
+    if (item != NON_ITEM)
+    {
+        init_item(item);
+        return item;
+    }
+
+    const bool restock = _free_mitm_slots.empty();
+
     for (item = 0; item < (MAX_ITEMS - reserve); item++)
         if (!mitm[item].defined())
             break;
 
+    if (restock)
+    {
+        for (int i = item + 1; i < MAX_ITEMS; i++)
+            if (!mitm[i].defined())
+                _free_mitm_slots.push_back(i);
+    }
+
     if (item >= MAX_ITEMS - reserve)
     {
         if (crawl_state.game_is_arena())
@@ -691,6 +738,7 @@ void destroy_item(int dest, bool never_created)
 
     unlink_item(dest);
     destroy_item(mitm[dest], never_created);
+    _note_free_mitm_slot(dest);
 }
 
 static void _handle_gone_item(const item_def &item)
@@ -2166,6 +2214,12 @@ bool move_item_to_grid(int *const obj, const coord_def& p, bool silent)
         return true;
     }
 
+    // A perishable item reaching the floor (including by merging into a
+    // stack already here) may be due to rot sooner than anything the last
+    // decay sweep saw.
+    if (item.base_type == OBJ_CORPSES || is_perishable_stack(item))
+        reset_rot_schedule();
+
     // If it's a stackable type or stationary item that's not a net...
     int movable_ind = -1;
     if (move_below || is_stackable_item(item))
@@ -2823,8 +2877,6 @@ static int _autopickup_subtype(const item_def &item)
 
 static bool _is_option_autopickup(const item_def &item, bool ignore_force)
 {
-    string iname = _autopickup_item_name(item);
-
     if (item.base_type < NUM_OBJECT_CLASSES)
     {
         const int force = you.force_autopickup[item.base_type][_autopickup_subtype(item)];
@@ -2834,6 +2886,11 @@ static bool _is_option_autopickup(const item_def &item, bool ignore_force)
     else
         return false;
 
+    // Deriving the annotated name runs the stash-annotation Lua hook and
+    // builds the full item name; don't pay for it until we know the
+    // item-type toggle menu didn't already settle the question.
+    const string iname = _autopickup_item_name(item);
+
 #ifdef CLUA_BINDINGS
     maybe_bool res = clua.callmaybefn("ch_force_autopickup", "is",
                                       &item, iname.c_str());
@@ -101,14 +101,7 @@ int KillMaster::total_kills() const
 {
     int grandtotal = 0;
     for (int i = KC_YOU; i < KC_NCATEGORIES; ++i)
-    {
-        if (categorized_kills[i].empty())
-            continue;
-
-        vector<kill_exp> kills;
-        int count = categorized_kills[i].get_kills(kills);
-        grandtotal += count;
-    }
+        grandtotal += categorized_kills[i].total_kills();
     return grandtotal;
 }
 
@@ -304,6 +297,16 @@ void Kills::record_kill(const monster* mon)
         k = kill_def(mon);
 }
 
+// Just the count, without the described and sorted kill_exp list that
+// get_kills() builds for display.
+int Kills::total_kills() const
+{
+    int count = 0;
+    for (const auto &entry : kills)
+        count += entry.second.kills;
+    return count + ghosts.size();
+}
+
 int Kills::get_kills(vector<kill_exp> &all_kills) const
 {
     int count = 0;
@@ -20,11 +20,15 @@
 #include "mon-act.h"
 #include "mon-death.h"
 #include "mon-poly.h"
+#include "random.h"
 #include "religion.h"
 #include "stairs.h"
 #include "state.h"
 #include "stringutil.h"
+#include "tags.h"
 #include "tileview.h"
+#include "travel.h"
+#include "unwind.h"
 #include "view.h"
 #include "wiz-dgn.h"
 
@@ -103,6 +107,47 @@ LUAFN(debug_generate_level)
     return 0;
 }
 
+// Reseed all RNG streams from a fixed value, so that scripts (benchmarks
+// in particular) can make successive runs comparable.
+LUAFN(debug_reset_rng)
+{
+    seed_rng(static_cast<uint32_t>(luaL_checkint(ls, 1)));
+    return 0;
+}
+
+// Flood-fill the level from the player's position, as travel and explore
+// do, and return the number of cells reached. Exists chiefly so scripts
+// can exercise (and time) the travel flood on a freshly built level.
+LUAFN(debug_travel_flood)
+{
+    travel_pathfind tp;
+    tp.set_floodseed(you.pos());
+    tp.pathfind(RMODE_CONNECTIVITY);
+
+    int reached = 0;
+    for (rectangle_iterator ri(0); ri; ++ri)
+        if (travel_point_distance[ri->x][ri->y])
+            reached++;
+    PLUARET(number, reached);
+}
+
+// Marshall the current level to a memory buffer and unmarshall it again,
+// exactly as saving and reloading the level would, and return the buffer
+// size in bytes. The read rebuilds env in place from data just written
+// from it, so the level comes back unchanged.
+LUAFN(debug_marshall_level)
+{
+    vector<unsigned char> buf;
+    writer outf(&buf);
+    tag_write(TAG_LEVEL, outf);
+
+    reader inf(buf, TAG_MINOR_VERSION);
+    unwind_var<int> minor(crawl_state.minor_version, TAG_MINOR_VERSION);
+    tag_read(inf, TAG_LEVEL);
+
+    PLUARET(number, buf.size());
+}
+
 LUAFN(debug_reveal_mimics)
 {
     for (rectangle_iterator ri(1); ri; ++ri)
@@ -374,6 +419,9 @@ const struct luaL_reg debug_dlib[] =
 { "up_stairs", debug_up_stairs },
 { "flush_map_memory", debug_flush_map_memory },
 { "generate_level", debug_generate_level },
+{ "reset_rng", debug_reset_rng },
+{ "travel_flood", debug_travel_flood },
+{ "marshall_level", debug_marshall_level },
 { "reveal_mimics", debug_reveal_mimics },
 { "los_changed", debug_los_changed },
 { "dump_map", debug_dump_map },
@@ -502,17 +502,72 @@ void putwch(ucs_t chr)
 #endif
 }
 
+// ncurses minimizes what reaches the terminal, but pushing every viewport
+// cell through textcolour()/addnwstr() on each redraw is expensive by
+// itself. Keep a shadow copy of what puttext() last emitted and only
+// re-emit cells that changed. Anything else that scribbles over the
+// viewport must invalidate the shadow (see clrscr() and fakecursorxy()).
+struct shadow_cell
+{
+    ucs_t glyph;
+    int colour; // -1 when the on-screen contents are unknown
+};
+static vector<shadow_cell> _puttext_shadow;
+static int _shadow_x1 = -1, _shadow_y1 = -1;
+static coord_def _shadow_size(-1, -1);
+
+static void _invalidate_shadow()
+{
+    _shadow_x1 = -1;
+}
+
+static void _invalidate_shadow_at(int x, int y)
+{
+    if (_shadow_x1 == -1)
+        return;
+    const int sx = x - _shadow_x1, sy = y - _shadow_y1;
+    if (sx < 0 || sx >= _shadow_size.x || sy < 0 || sy >= _shadow_size.y)
+        return;
+    _puttext_shadow[sy * _shadow_size.x + sx].colour = -1;
+}
+
 void puttext(int x1, int y1, const crawl_view_buffer &vbuf)
 {
     const screen_cell_t *cell = vbuf;
     const coord_def size = vbuf.size();
+
+    const bool diff = x1 == _shadow_x1 && y1 == _shadow_y1
+                      && size == _shadow_size;
+    if (!diff)
+    {
+        _shadow_x1 = x1;
+        _shadow_y1 = y1;
+        _shadow_size = size;
+        _puttext_shadow.resize(size.x * size.y);
+    }
+
+    int i = 0;
     for (int y = 0; y < size.y; ++y)
     {
-        cgotoxy(x1, y1 + y);
-        for (int x = 0; x < size.x; ++x)
+        bool needs_goto = true;
+        for (int x = 0; x < size.x; ++x, ++cell, ++i)
         {
+            shadow_cell &sh = _puttext_shadow[i];
+            if (diff && sh.colour == (int)cell->colour
+                && sh.glyph == cell->glyph)
+            {
+                needs_goto = true;
+                continue;
+            }
+
+            if (needs_goto)
+            {
+                cgotoxy(x1 + x, y1 + y);
+                needs_goto = false;
+            }
             put_colour_ch(cell->colour, cell->glyph);
-            cell++;
+            sh.glyph = cell->glyph;
+            sh.colour = cell->colour;
         }
     }
     update_screen();
@@ -560,6 +615,7 @@ int num_to_lines(int num)
 
 void clrscr()
 {
+    _invalidate_shadow();
     textcolour(LIGHTGREY);
     textbackground(BLACK);
     clear();
@@ -803,6 +859,8 @@ void fakecursorxy(int x, int y)
     faked_y = y - 1;
     flip_colour(c);
     write_char_at(y - 1, x - 1, oldmangledch = c);
+    // The on-screen cell no longer matches what puttext() last wrote.
+    _invalidate_shadow_at(x, y);
     move(y - 1, x - 1);
 }
 
@@ -827,6 +885,15 @@ void delay(unsigned int time)
     {
         tiles.send_message("{\"msg\":\"delay\",\"t\":%d}", time);
         tiles.flush_messages();
+
+        // The web client inhibits its message queue for the given time
+        // when it sees the delay message, so animation frames already
+        // play back at the right pace on its side. If the game is being
+        // played through the web, sleeping here as well only stalls the
+        // main loop and input handling for the duration of every beam
+        // and flash frame.
+        if (tiles.is_controlled_from_web())
+            return;
     }
 #endif
 
@@ -51,7 +51,10 @@
 #include "coord.h"
 #include "coordit.h"
 #include "env.h"
+#include "files.h"
 #include "losglobal.h"
+#include "syscalls.h"
+#include "tags.h"
 
 // These determine what rays are cast in the precomputation,
 // and affect start-up time significantly.
@@ -429,6 +432,230 @@ static void _create_blockrays()
           n_cellrays, (unsigned int)fullrays.size(), n_min_rays);
 }
 
+// ======================================================================
+// Persistent ray table cache.
+//
+// The tables built by raycast() depend only on LOS_MAX_RANGE and the
+// geometry code, so they are identical for every launch. Computing
+// them is expensive enough to matter where a fresh process is spawned
+// per game, so they are cached in the versioned save directory and
+// reloaded on subsequent launches.
+
+// Bump this whenever the table format or the ray geometry changes.
+#define LOS_CACHE_VERSION 1
+#define LOS_CACHE_MAGIC   0x4c4f5343 // "LOSC"
+
+static string _ray_cache_path()
+{
+    return savedir_versioned_path("los.cache");
+}
+
+// Doubles are stored bitwise; the cached values must match exactly
+// what raycast() would have produced.
+static void _marshall_ray_double(writer& outf, double d)
+{
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    marshallInt(outf, (int32_t)(bits >> 32));
+    marshallInt(outf, (int32_t)(bits & 0xffffffffUL));
+}
+
+static double _unmarshall_ray_double(reader& inf)
+{
+    const uint64_t hi = (uint32_t)unmarshallInt(inf);
+    const uint64_t lo = (uint32_t)unmarshallInt(inf);
+    const uint64_t bits = hi << 32 | lo;
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return d;
+}
+
+static void _marshall_bit_vector(writer& outf, const bit_vector* bv, int bits)
+{
+    for (int i = 0; i < bits; i += 8)
+    {
+        uint8_t b = 0;
+        for (int j = 0; j < 8 && i + j < bits; ++j)
+            if (bv->get(i + j))
+                b |= 1 << j;
+        marshallByte(outf, b);
+    }
+}
+
+static void _unmarshall_bit_vector(reader& inf, bit_vector* bv, int bits)
+{
+    for (int i = 0; i < bits; i += 8)
+    {
+        const uint8_t b = unmarshallUByte(inf);
+        for (int j = 0; j < 8 && i + j < bits; ++j)
+            bv->set(i + j, b & 1 << j);
+    }
+}
+
+static void _write_ray_cache()
+{
+    const string path = _ray_cache_path();
+    const string tmp  = path + ".tmp";
+    FILE* fp = fopen_u(tmp.c_str(), "wb");
+    if (!fp)
+        return;
+
+    writer outf(tmp, fp, true);
+    marshallInt(outf, LOS_CACHE_MAGIC);
+    marshallInt(outf, LOS_CACHE_VERSION);
+    marshallInt(outf, LOS_MAX_RANGE);
+    marshallInt(outf, LOS_MAX_ANGLE);
+    marshallInt(outf, LOS_INTERCEPT_MULT);
+
+    marshallInt(outf, fullrays.size());
+    for (const los_ray& ray : fullrays)
+    {
+        _marshall_ray_double(outf, ray.r.start.x);
+        _marshall_ray_double(outf, ray.r.start.y);
+        _marshall_ray_double(outf, ray.r.dir.x);
+        _marshall_ray_double(outf, ray.r.dir.y);
+        marshallInt(outf, ray.start);
+        marshallInt(outf, ray.length);
+    }
+
+    marshallInt(outf, ray_coords.size());
+    for (const coord_def& c : ray_coords)
+        marshallCoord(outf, c);
+
+    const int n_min_rays = cellray_ends.size();
+    marshallInt(outf, n_min_rays);
+    for (const coord_def& c : cellray_ends)
+        marshallCoord(outf, c);
+
+    for (quadrant_iterator qi; qi; ++qi)
+        _marshall_bit_vector(outf, blockrays(*qi), n_min_rays);
+
+    // Cellrays reference their fullray by index; the start offsets
+    // are unique, so they serve as lookup keys.
+    map<unsigned int, int> ray_index;
+    for (unsigned int i = 0; i < fullrays.size(); ++i)
+        ray_index[fullrays[i].start] = i;
+
+    for (quadrant_iterator qi; qi; ++qi)
+    {
+        const vector<cellray>& min = min_cellrays(*qi);
+        marshallInt(outf, min.size());
+        for (const cellray& c : min)
+        {
+            marshallInt(outf, ray_index[c.ray.start]);
+            marshallInt(outf, c.end);
+            marshallInt(outf, c.imbalance);
+            marshallBoolean(outf, c.first_diag);
+        }
+    }
+
+    fclose(fp);
+    if (outf.succeeded())
+        rename_u(tmp.c_str(), path.c_str());
+    else
+        unlink_u(tmp.c_str());
+}
+
+static bool _load_ray_cache()
+{
+    FILE* fp = fopen_u(_ray_cache_path().c_str(), "rb");
+    if (!fp)
+        return false;
+
+    bool ok = false;
+    try
+    {
+        reader inf(fp);
+        inf.set_safe_read(true);
+
+        if (unmarshallInt(inf) == LOS_CACHE_MAGIC
+            && unmarshallInt(inf) == LOS_CACHE_VERSION
+            && unmarshallInt(inf) == LOS_MAX_RANGE
+            && unmarshallInt(inf) == LOS_MAX_ANGLE
+            && unmarshallInt(inf) == LOS_INTERCEPT_MULT)
+        {
+            const int n_fullrays = unmarshallInt(inf);
+            for (int i = 0; i < n_fullrays; ++i)
+            {
+                const double x0 = _unmarshall_ray_double(inf);
+                const double y0 = _unmarshall_ray_double(inf);
+                const double xd = _unmarshall_ray_double(inf);
+                const double yd = _unmarshall_ray_double(inf);
+                los_ray ray((geom::ray(x0, y0, xd, yd)));
+                ray.start  = unmarshallInt(inf);
+                ray.length = unmarshallInt(inf);
+                fullrays.push_back(ray);
+            }
+
+            const int n_coords = unmarshallInt(inf);
+            for (int i = 0; i < n_coords; ++i)
+                ray_coords.push_back(unmarshallCoord(inf));
+
+            const int n_min_rays = unmarshallInt(inf);
+            cellray_ends.resize(n_min_rays);
+            for (int i = 0; i < n_min_rays; ++i)
+                cellray_ends[i] = unmarshallCoord(inf);
+
+            for (quadrant_iterator qi; qi; ++qi)
+            {
+                blockrays(*qi) = new bit_vector(n_min_rays);
+                _unmarshall_bit_vector(inf, blockrays(*qi), n_min_rays);
+            }
+
+            ok = true;
+            for (quadrant_iterator qi; qi && ok; ++qi)
+            {
+                const int count = unmarshallInt(inf);
+                vector<cellray>& min = min_cellrays(*qi);
+                for (int i = 0; i < count && ok; ++i)
+                {
+                    const unsigned int idx = unmarshallInt(inf);
+                    const unsigned int end = unmarshallInt(inf);
+                    if (idx >= fullrays.size() || end >= fullrays[idx].length)
+                    {
+                        ok = false;
+                        break;
+                    }
+                    cellray c(fullrays[idx], end);
+                    c.imbalance  = unmarshallInt(inf);
+                    c.first_diag = unmarshallBoolean(inf);
+                    min.push_back(c);
+                }
+            }
+
+            if (ok)
+            {
+                dead_rays  = new bit_vector(n_min_rays);
+                smoke_rays = new bit_vector(n_min_rays);
+            }
+        }
+    }
+    catch (const short_read_exception&)
+    {
+        ok = false;
+    }
+    fclose(fp);
+
+    if (!ok)
+    {
+        // Stale or truncated cache; drop any partially loaded state
+        // and recompute from scratch.
+        fullrays.clear();
+        ray_coords.clear();
+        cellray_ends.clear();
+        for (quadrant_iterator qi; qi; ++qi)
+        {
+            delete blockrays(*qi);
+            blockrays(*qi) = nullptr;
+            min_cellrays(*qi).clear();
+        }
+        delete dead_rays;
+        delete smoke_rays;
+        dead_rays = smoke_rays = nullptr;
+    }
+    return ok;
+}
+
 static int _gcd(int x, int y)
 {
     int tmp;
@@ -458,6 +685,11 @@ static void raycast()
     // We have a considerable amount of overkill.
     done_raycast = true;
 
+    // Identical tables may already have been computed by an earlier
+    // launch of the same version.
+    if (_load_ray_cache())
+        return;
+
     // register perpendiculars FIRST, to make them top choice
     // when selecting beams
     _register_ray(geom::ray(0.5, 0.5, 0.0, 1.0));
@@ -498,6 +730,8 @@ static void raycast()
 
     // Now create the appropriate blockrays array
     _create_blockrays();
+
+    _write_ray_cache();
 }
 
 static int _imbalance(ray_def ray, const coord_def& target)
@@ -589,16 +823,30 @@ struct opacity_trans : public opacity_func
     const coord_def& source;
     int signx, signy;
     const opacity_func& orig;
+    // find_ray cycles through many candidate cellrays whose footprints
+    // overlap heavily, probing the same cells over and over. Opacity is
+    // side-effect free and the level can't change in the middle of one
+    // search, so cache each quadrant cell's answer on first query.
+    mutable int8_t memo[LOS_MAX_RANGE + 1][LOS_MAX_RANGE + 1];
 
     opacity_trans(const opacity_func& opc, const coord_def& s, int sx, int sy)
         : source(s), signx(sx), signy(sy), orig(opc)
     {
+        memset(memo, -1, sizeof(memo));
     }
 
     CLONE(opacity_trans)
 
     opacity_type operator()(const coord_def &l) const override
     {
+        if (l.x >= 0 && l.x <= LOS_MAX_RANGE
+            && l.y >= 0 && l.y <= LOS_MAX_RANGE)
+        {
+            int8_t &slot = memo[l.x][l.y];
+            if (slot < 0)
+                slot = orig(transform(l));
+            return opacity_type(slot);
+        }
         return orig(transform(l));
     }
 
@@ -608,6 +856,34 @@ struct opacity_trans : public opacity_func
     }
 };
 
+// Shared ray memo: player targeting previews and monster tracer
+// evaluation both resolve their beams through find_ray with the same
+// few global opacity rules, and within one turn they re-ask for the
+// same source/target pairs constantly (every preview redraw, every
+// caster considering the same corridor). Everything those rules read -
+// terrain, opaque clouds, sight-blocking monsters - ticks the LOS
+// epoch, so the whole memo is validated by one counter compare and
+// dropped wholesale when anything changes.
+struct ray_memo_key
+{
+    coord_def source, target;
+    const opacity_func *opc;
+    int range;
+
+    bool operator<(const ray_memo_key &k) const
+    {
+        if (source != k.source)
+            return source < k.source;
+        if (target != k.target)
+            return target < k.target;
+        if (opc != k.opc)
+            return opc < k.opc;
+        return range < k.range;
+    }
+};
+static map<ray_memo_key, pair<bool, ray_def>> _ray_memo;
+static unsigned _ray_memo_epoch = 0;
+
 // Find a nonblocked ray from source to target. Return false if no
 // such ray could be found, otherwise return true and fill ray
 // appropriately.
@@ -622,6 +898,28 @@ bool find_ray(const coord_def& source, const coord_def& target,
     if (target == source || !map_bounds(source) || !map_bounds(target))
         return false;
 
+    // Only the stateless global opacity rules are safe to key by
+    // address; ray cycling deliberately wants a different answer for
+    // the same query.
+    const bool memoize = !cycle
+                         && (&opc == &opc_solid_see || &opc == &opc_default);
+    const ray_memo_key key = { source, target, &opc, range };
+    if (memoize)
+    {
+        if (_ray_memo_epoch != los_epoch())
+        {
+            _ray_memo.clear();
+            _ray_memo_epoch = los_epoch();
+        }
+        auto cached = _ray_memo.find(key);
+        if (cached != _ray_memo.end())
+        {
+            if (cached->second.first)
+                ray = cached->second.second;
+            return cached->second.first;
+        }
+    }
+
     const int signx = ((target.x - source.x >= 0) ? 1 : -1);
     const int signy = ((target.y - source.y >= 0) ? 1 : -1);
     const int absx  = signx * (target.x - source.x);
@@ -630,7 +928,11 @@ bool find_ray(const coord_def& source, const coord_def& target,
     opacity_trans opc_trans = opacity_trans(opc, source, signx, signy);
 
     if (!_find_ray_se(abs, ray, opc_trans, range, cycle))
+    {
+        if (memoize)
+            _ray_memo[key] = make_pair(false, ray_def());
         return false;
+    }
 
     if (signx < 0)
         ray.r.start.x = 1.0 - ray.r.start.x;
@@ -642,6 +944,9 @@ bool find_ray(const coord_def& source, const coord_def& target,
     ray.r.start.x += source.x;
     ray.r.start.y += source.y;
 
+    if (memoize)
+        _ray_memo[key] = make_pair(true, ray);
+
     return true;
 }
 
@@ -785,51 +1090,88 @@ bool cell_see_cell_nocache(const coord_def& p1, const coord_def& p2)
 // Smoke will now only block LOS after two cells of smoke. This is
 // done by updating with a second array.
 
-static void _losight_quadrant(los_grid& sh, const los_param& dat, int sx, int sy)
+// Flat per-call snapshot of the los_param planes. The quadrant loops
+// below visit every cell once per quadrant and every cellray end once,
+// so going through the los_param/opacity_func virtual pair there meant
+// thousands of indirect calls re-reading env.grid and cloud state per
+// LOS update. Sampling each cell of the disc exactly once up front
+// leaves the inner loops reading plain arrays.
+struct los_snapshot
 {
-    const unsigned int num_cellrays = cellray_ends.size();
+    SquareArray<opacity_type, LOS_MAX_RANGE> opacity;
+    SquareArray<bool, LOS_MAX_RANGE> bounds;
+};
+
+static void _snapshot_los_param(const los_param& dat, los_snapshot& snap)
+{
+    for (int y = -LOS_MAX_RANGE; y <= LOS_MAX_RANGE; ++y)
+        for (int x = -LOS_MAX_RANGE; x <= LOS_MAX_RANGE; ++x)
+        {
+            const coord_def p(x, y);
+            const bool in = dat.los_bounds(p);
+            snap.bounds(p) = in;
+            snap.opacity(p) = in ? dat.opacity(p) : OPC_OPAQUE;
+        }
+}
 
-    dead_rays->reset();
+// Determine which cellrays in one quadrant are blocked by opaque
+// or half-opaque cells, filling the passed bit vector.
+static void _block_quadrant_rays(bit_vector& dead, const los_snapshot& snap,
+                                 int sx, int sy)
+{
+    dead.reset();
     smoke_rays->reset();
 
     for (quadrant_iterator qi; qi; ++qi)
     {
         coord_def p = coord_def(sx*(qi->x), sy*(qi->y));
-        if (!dat.los_bounds(p))
+        if (!snap.bounds(p))
             continue;
 
-        switch (dat.opacity(p))
+        switch (snap.opacity(p))
         {
         case OPC_OPAQUE:
             // Block the appropriate rays.
-            *dead_rays |= *blockrays(*qi);
+            dead |= *blockrays(*qi);
             break;
         case OPC_HALF:
             // Block rays which have already seen a cloud.
-            *dead_rays  |= (*smoke_rays & *blockrays(*qi));
+            dead  |= (*smoke_rays & *blockrays(*qi));
             *smoke_rays |= *blockrays(*qi);
             break;
         default:
             break;
         }
     }
+}
 
-    // Ray calculation done. Now work out which cells in this
-    // quadrant are visible.
+// Mark the end cells of all surviving cellrays in one quadrant
+// as visible.
+static void _set_quadrant_cells(los_grid& sh, const bit_vector& dead,
+                                const los_snapshot& snap, int sx, int sy)
+{
+    const unsigned int num_cellrays = cellray_ends.size();
     for (unsigned int rayidx = 0; rayidx < num_cellrays; ++rayidx)
     {
         // make the cells seen by this ray at this point visible
-        if (!dead_rays->get(rayidx))
+        if (!dead.get(rayidx))
         {
             // This ray is alive, thus the end cell is visible.
             const coord_def p = coord_def(sx * cellray_ends[rayidx].x,
                                           sy * cellray_ends[rayidx].y);
-            if (dat.los_bounds(p))
+            if (snap.bounds(p))
                 sh(p) = true;
         }
     }
 }
 
+static void _losight_quadrant(los_grid& sh, const los_snapshot& snap,
+                              int sx, int sy)
+{
+    _block_quadrant_rays(*dead_rays, snap, sx, sy);
+    _set_quadrant_cells(sh, *dead_rays, snap, sx, sy);
+}
+
 struct los_param_funcs : public los_param
 {
     coord_def center;
@@ -853,26 +1195,131 @@ struct los_param_funcs : public los_param
     }
 };
 
+static const int quadrant_x[4] = {  1, -1, -1,  1 };
+static const int quadrant_y[4] = {  1,  1, -1, -1 };
+
 void losight(los_grid& sh, const coord_def& center,
              const opacity_func& opc, const circle_def& bounds)
 {
     const los_param& dat = los_param_funcs(center, opc, bounds);
+    los_snapshot snap;
+    _snapshot_los_param(dat, snap);
 
     sh.init(false);
 
     // Do precomputations if necessary.
     raycast();
 
-    const int quadrant_x[4] = {  1, -1, -1,  1 };
-    const int quadrant_y[4] = {  1,  1, -1, -1 };
     for (int q = 0; q < 4; ++q)
-        _losight_quadrant(sh, dat, quadrant_x[q], quadrant_y[q]);
+        _losight_quadrant(sh, snap, quadrant_x[q], quadrant_y[q]);
 
     // Center is always visible.
     const coord_def o = coord_def(0,0);
     sh(o) = true;
 }
 
+los_inc_state::los_inc_state()
+    : valid(false)
+{
+    for (int q = 0; q < 4; ++q)
+        dead[q] = nullptr;
+}
+
+los_inc_state::los_inc_state(const los_inc_state& other)
+    : valid(other.valid)
+{
+    for (int q = 0; q < 4; ++q)
+        dead[q] = other.dead[q] ? new bit_vector(*other.dead[q]) : nullptr;
+}
+
+los_inc_state::~los_inc_state()
+{
+    for (int q = 0; q < 4; ++q)
+        delete dead[q];
+}
+
+void los_inc_state::invalidate()
+{
+    valid = false;
+}
+
+// As losight(), but additionally keep the per-quadrant ray state
+// so that subsequent changes can be applied incrementally.
+void losight(los_grid& sh, los_inc_state& state, const coord_def& center,
+             const opacity_func& opc, const circle_def& bounds)
+{
+    const los_param& dat = los_param_funcs(center, opc, bounds);
+    los_snapshot snap;
+    _snapshot_los_param(dat, snap);
+
+    sh.init(false);
+
+    raycast();
+
+    for (int q = 0; q < 4; ++q)
+    {
+        if (!state.dead[q])
+            state.dead[q] = new bit_vector(cellray_ends.size());
+        _block_quadrant_rays(*state.dead[q], snap, quadrant_x[q], quadrant_y[q]);
+        _set_quadrant_cells(sh, *state.dead[q], snap, quadrant_x[q], quadrant_y[q]);
+    }
+
+    const coord_def o = coord_def(0,0);
+    sh(o) = true;
+    state.valid = true;
+}
+
+// Re-propagate LOS around a set of changed cells, rescanning only
+// the quadrants the changes fall into and rebuilding the visible
+// set from the cached ray state of the others. Returns false if no
+// cached state is available or all four quadrants are dirty, in
+// which case the caller should do a full update.
+bool losight_incremental(los_grid& sh, los_inc_state& state,
+                         const coord_def& center, const opacity_func& opc,
+                         const circle_def& bounds,
+                         const vector<coord_def>& changed)
+{
+    if (!state.valid)
+        return false;
+
+    bool dirty[4] = { false, false, false, false };
+    for (const coord_def& c : changed)
+    {
+        const coord_def d = c - center;
+        if (d.rdist() > LOS_MAX_RANGE)
+            continue;
+        // A cell on a quadrant boundary blocks rays of both
+        // adjacent quadrants.
+        for (int q = 0; q < 4; ++q)
+            if (d.x * quadrant_x[q] >= 0 && d.y * quadrant_y[q] >= 0)
+                dirty[q] = true;
+    }
+
+    if (dirty[0] && dirty[1] && dirty[2] && dirty[3])
+        return false;
+
+    raycast();
+
+    const los_param& dat = los_param_funcs(center, opc, bounds);
+    los_snapshot snap;
+    _snapshot_los_param(dat, snap);
+
+    for (int q = 0; q < 4; ++q)
+        if (dirty[q])
+            _block_quadrant_rays(*state.dead[q], snap, quadrant_x[q], quadrant_y[q]);
+
+    // Cells on quadrant boundaries may be seen by rays of either
+    // adjacent quadrant, so the visible set is rebuilt from all
+    // four cached ray states; only the scans above are expensive.
+    sh.init(false);
+    for (int q = 0; q < 4; ++q)
+        _set_quadrant_cells(sh, *state.dead[q], snap, quadrant_x[q], quadrant_y[q]);
+
+    const coord_def o = coord_def(0,0);
+    sh(o) = true;
+    return true;
+}
+
 opacity_type mons_opacity(const monster* mon, los_type how)
 {
     // no regard for LOS_ARENA
@@ -888,10 +1335,22 @@ opacity_type mons_opacity(const monster* mon, los_type how)
 /////////////////////////////////////
 // A start at tracking LOS changes.
 
+// Monotonic counter ticked whenever anything LOS-relevant (terrain,
+// opaque clouds, doors) changes anywhere on the level. Lets caches of
+// derived geometry - e.g. explosion footprints in beam.cc - validate
+// with a single integer compare.
+static unsigned _los_epoch = 1;
+
+unsigned los_epoch()
+{
+    return _los_epoch;
+}
+
 // Something that affects LOS (with default parameters)
 // has changed somewhere.
 static void _handle_los_change()
 {
+    ++_los_epoch;
     invalidate_agrid();
 }
 
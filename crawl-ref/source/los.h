@@ -6,6 +6,7 @@
 #ifndef LOS_H
 #define LOS_H
 
+#include "bitary.h"
 #include "coord-circle.h"
 #include "losparam.h"
 
@@ -41,14 +42,38 @@ bool cell_see_cell_nocache(const coord_def& p1, const coord_def& p2);
 
 typedef SquareArray<bool, LOS_MAX_RANGE> los_grid;
 
+// Per-quadrant blocked-ray state cached between LOS updates,
+// allowing losight_incremental() to rescan only dirty quadrants.
+struct los_inc_state
+{
+    bit_vector* dead[4];
+    bool valid;
+
+    los_inc_state();
+    los_inc_state(const los_inc_state& other);
+    ~los_inc_state();
+    void invalidate();
+
+private:
+    los_inc_state& operator=(const los_inc_state&);
+};
+
 void clear_rays_on_exit();
 void losight(los_grid& sh, const coord_def& center,
              const opacity_func &opc = opc_default,
              const circle_def &bds = BDS_DEFAULT);
+void losight(los_grid& sh, los_inc_state& state, const coord_def& center,
+             const opacity_func &opc = opc_default,
+             const circle_def &bds = BDS_DEFAULT);
+bool losight_incremental(los_grid& sh, los_inc_state& state,
+                         const coord_def& center, const opacity_func &opc,
+                         const circle_def &bds,
+                         const vector<coord_def>& changed);
 
 void los_actor_moved(const actor* act, const coord_def& oldpos);
 void los_monster_died(const monster* mon);
 void los_terrain_changed(const coord_def& p);
 void los_changed();
+unsigned los_epoch();
 opacity_type mons_opacity(const monster* mon, los_type how);
 #endif
@@ -35,6 +35,23 @@ los_def& los_def::operator=(const los_def& los)
     return *this;
 }
 
+void los_def::update()
+{
+    losight(show, inc, center, *opc, bds);
+}
+
+// Update LOS given only the set of cells whose opacity may have
+// changed since the last update. Falls back to (and returns false
+// after) a full update when the changes touch all quadrants or no
+// cached ray state is available.
+bool los_def::update_incremental(const vector<coord_def>& changed)
+{
+    if (losight_incremental(show, inc, center, *opc, bds, changed))
+        return true;
+    update();
+    return false;
+}
+
 void los_def::init(const coord_def &c, const opacity_func &o,
                    const circle_def &b)
 {
@@ -49,14 +66,10 @@ los_def::~los_def()
     delete opc;
 }
 
-void los_def::update()
-{
-    losight(show, center, *opc, bds);
-}
-
 void los_def::set_center(const coord_def& c)
 {
     center = c;
+    inc.invalidate();
 }
 
 coord_def los_def::get_center() const
@@ -68,11 +81,13 @@ void los_def::set_opacity(const opacity_func &o)
 {
     delete opc;
     opc = o.clone();
+    inc.invalidate();
 }
 
 void los_def::set_bounds(const circle_def &b)
 {
     bds = b;
+    inc.invalidate();
 }
 
 circle_def los_def::get_bounds() const
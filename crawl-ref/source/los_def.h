@@ -9,6 +9,7 @@ class los_def
     coord_def center;
     opacity_func const * opc;
     circle_def bds;
+    los_inc_state inc;
 
 public:
     los_def();
@@ -26,6 +27,7 @@ public:
     circle_def get_bounds() const;
 
     void update();
+    bool update_incremental(const vector<coord_def>& changed);
     bool in_bounds(const coord_def& p) const;
     bool see_cell(const coord_def& p) const;
 };
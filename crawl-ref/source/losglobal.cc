@@ -13,9 +13,35 @@ typedef uint8_t losfield_t;
 typedef losfield_t halflos_t[LOS_MAX_RANGE+1][2*LOS_MAX_RANGE+1];
 static const int o_half_x = 0;
 static const int o_half_y = LOS_MAX_RANGE;
-typedef halflos_t globallos_t[GXM][GYM];
 
-static globallos_t globallos;
+// Pairwise LOS is only ever queried for a small fraction of map
+// cells, so the per-source halflos blocks are allocated lazily on
+// first use and invalidated by comparing a generation counter
+// instead of wiping a multi-megabyte array on every level change.
+struct halflos_block
+{
+    uint32_t generation;
+    halflos_t los;
+};
+
+static halflos_block* globallos[GXM][GYM];
+static uint32_t globallos_generation = 1;
+
+static halflos_t* _get_halflos(const coord_def& p)
+{
+    halflos_block*& block = globallos[p.x][p.y];
+    if (!block)
+    {
+        block = new halflos_block;
+        block->generation = 0;
+    }
+    if (block->generation != globallos_generation)
+    {
+        memset(block->los, 0, sizeof(halflos_t));
+        block->generation = globallos_generation;
+    }
+    return &block->los;
+}
 
 static losfield_t* _lookup_globallos(const coord_def& p, const coord_def& q)
 {
@@ -28,9 +54,9 @@ static losfield_t* _lookup_globallos(const coord_def& p, const coord_def& q)
         return nullptr;
     // p < q iff p.x < q.x || p.x == q.x && p.y < q.y
     if (diff < coord_def(0, 0))
-        return &globallos[q.x][q.y][-diff.x + o_half_x][-diff.y + o_half_y];
+        return &(*_get_halflos(q))[-diff.x + o_half_x][-diff.y + o_half_y];
     else
-        return &globallos[p.x][p.y][ diff.x + o_half_x][ diff.y + o_half_y];
+        return &(*_get_halflos(p))[ diff.x + o_half_x][ diff.y + o_half_y];
 }
 
 static void _save_los(los_def* los, los_type l)
@@ -67,13 +93,25 @@ void invalidate_los_around(const coord_def& p)
     int y2 = min(p.y + LOS_MAX_RANGE, GYM - 1);
     for (int y = y1; y <= y2; y++)
         for (int x = x1; x <= x2; x++)
-            memset(globallos[x][y], 0, sizeof(halflos_t));
+        {
+            // Marking the block stale is enough; it's cleared on
+            // next access.
+            if (halflos_block* block = globallos[x][y])
+                block->generation = 0;
+        }
 }
 
 void invalidate_los()
 {
-    for (rectangle_iterator ri(0); ri; ++ri)
-        memset(globallos[ri->x][ri->y], 0, sizeof(halflos_t));
+    if (++globallos_generation == 0)
+    {
+        // Wrapped around; reset all allocated blocks so stale data
+        // can't match the restarted counter.
+        for (rectangle_iterator ri(0); ri; ++ri)
+            if (halflos_block* block = globallos[ri->x][ri->y])
+                block->generation = 0;
+        globallos_generation = 1;
+    }
 }
 
 static void _update_globallos_at(const coord_def& p, los_type l)
@@ -113,6 +151,43 @@ static void _update_globallos_at(const coord_def& p, los_type l)
     }
 }
 
+// Batched variant of cell_see_cell(): fill a mask over the whole LOS
+// disc around p in a single table walk, ensuring p's pairwise LOS is
+// computed at most once instead of potentially once per queried cell.
+// out is indexed by offset from p.
+void fill_los_mask(const coord_def& p, los_type l, los_grid& out)
+{
+    out.init(false);
+    if (!map_bounds(p))
+        return;
+
+    bool updated = false;
+    for (int y = -LOS_MAX_RANGE; y <= LOS_MAX_RANGE; y++)
+        for (int x = -LOS_MAX_RANGE; x <= LOS_MAX_RANGE; x++)
+        {
+            const coord_def d(x, y);
+            if (l == LOS_NONE)
+            {
+                out(d) = map_bounds(p + d);
+                continue;
+            }
+            losfield_t* flags = _lookup_globallos(p, p + d);
+            if (!flags)
+                continue;
+            if (!(*flags & (l << LOS_KNOWN)))
+            {
+                // One update covers every pair sourced at p.
+                if (!updated)
+                {
+                    _update_globallos_at(p, l);
+                    updated = true;
+                }
+                ASSERT(*flags & (l << LOS_KNOWN));
+            }
+            out(d) = bool(*flags & l);
+        }
+}
+
 bool cell_see_cell(const coord_def& p, const coord_def& q, los_type l)
 {
     if (l == LOS_NONE)
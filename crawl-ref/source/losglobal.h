@@ -1,9 +1,12 @@
 #ifndef LOSGLOBAL_H
 #define LOSGLOBAL_H
 
+#include "los.h"
+
 void invalidate_los_around(const coord_def& p);
 void invalidate_los();
 
 bool cell_see_cell(const coord_def& p, const coord_def& q, los_type l);
+void fill_los_mask(const coord_def& p, los_type l, los_grid& out);
 
 #endif
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "cio.h"
+#include "end.h"
 #include "files.h"
 #include "initfile.h"
 #include "libutil.h"
@@ -39,6 +40,7 @@
 #include "misc.h" // erase_val
 #include "options.h"
 #include "output.h"
+#include "random.h"
 #include "state.h"
 #include "state.h"
 #include "stringutil.h"
@@ -477,17 +479,41 @@ void macro_buf_add_cmd(command_type cmd, bool reverse)
 }
 
 /*
- * Adds keypresses from a sequence into the internal keybuffer. Does some
- * O(N^2) analysis to the sequence to apply keymaps.
+ * Returns the length of the longest trigger sequence in the given
+ * mapping, so matching can ignore candidates no trigger could equal.
+ */
+static unsigned int _longest_trigger(const macromap &mm)
+{
+    unsigned int len = 0;
+    for (const auto &entry : mm)
+        len = max(len, (unsigned int)entry.first.size());
+    return len;
+}
+
+/*
+ * Adds keypresses from a sequence into the internal keybuffer, applying
+ * keymaps. Candidate matches are capped at the longest trigger in the
+ * keymap, so a flood of buffered keys (held-down movement keys over
+ * a laggy connection) doesn't trigger quadratic rescans of the whole
+ * batch.
  */
 static void macro_buf_add_long(keyseq actions,
                                macromap &keymap = Keymaps[KMC_DEFAULT])
 {
-    keyseq tmp;
-
     // debug << "Adding: " << vtostr(actions) << endl;
     // debug.flush();
 
+    const unsigned int max_trigger = _longest_trigger(keymap);
+
+    // No keymaps in this context; pass the batch through unchanged.
+    if (!max_trigger)
+    {
+        macro_buf_add(actions, false, false);
+        return;
+    }
+
+    keyseq tmp;
+
     // Check whether any subsequences of the sequence are macros.
     // The matching starts from as early as possible, and is
     // as long as possible given the first constraint. I.e from
@@ -496,7 +522,8 @@ static void macro_buf_add_long(keyseq actions,
 
     while (!actions.empty())
     {
-        tmp = actions;
+        tmp.assign(actions.begin(),
+                   actions.begin() + min<size_t>(actions.size(), max_trigger));
 
         while (!tmp.empty())
         {
@@ -580,7 +607,14 @@ static void macro_buf_apply_command_macro()
     if (macro_keys_left > 0 || expanded_keys_left > 0)
         return;
 
-    keyseq tmp = Buffer;
+    // No trigger can match more keys than the longest macro, so don't
+    // copy (and then pop through) the entire buffer looking for one.
+    const unsigned int max_trigger = _longest_trigger(Macros);
+    if (!max_trigger)
+        return;
+
+    keyseq tmp(Buffer.begin(),
+               Buffer.begin() + min<size_t>(Buffer.size(), max_trigger));
 
     // find the longest match from the start of the buffer and replace it
     while (!tmp.empty())
@@ -690,6 +724,122 @@ void macro_save()
     fclose(f);
 }
 
+/*
+ * Input journal (-record / -replay): a session's only sources of
+ * nondeterminism are the RNG seed and the raw key stream, and both pass
+ * through here, so journaling them is enough to replay a whole game.
+ * The file is plain text: a "seed" line, an optional "seed32" line for
+ * a -seed game, then one raw key code per line.
+ */
+static FILE     *_journal_out = nullptr;
+static deque<int> _journal_keys;
+static bool      _journal_replaying = false;
+static uint32_t  _journal_seed32 = 0;
+
+bool journal_replay_active()
+{
+    return _journal_replaying;
+}
+
+uint32_t journal_replayed_fixed_seed()
+{
+    return _journal_seed32;
+}
+
+void journal_note_fixed_seed(uint32_t seed)
+{
+    if (!_journal_out)
+        return;
+    fprintf(_journal_out, "seed32 %x\n", seed);
+    fflush(_journal_out);
+}
+
+// Seed the RNG from (replay) or into (record) the journal. Called from
+// startup in place of the usual seed_rng(); returns false if no journal
+// was requested and the normal seeding should happen.
+bool journal_seed_rng()
+{
+    if (!crawl_state.journal_replay.empty())
+    {
+        FILE *f = fopen_u(crawl_state.journal_replay.c_str(), "r");
+        if (!f)
+        {
+            end(1, true, "Can't read journal (%s)",
+                crawl_state.journal_replay.c_str());
+        }
+
+        uint64_t seed_key[2] = { 0, 0 };
+        bool seeded = false;
+        char line[128];
+        while (fgets(line, sizeof(line), f))
+        {
+            unsigned long long hi, lo;
+            unsigned int s32;
+            int key;
+            // "seed32" must be tried before "seed": the latter's literal
+            // also matches the former's prefix.
+            if (sscanf(line, "seed32 %x", &s32) == 1)
+                _journal_seed32 = s32;
+            else if (sscanf(line, "seed %llx %llx", &hi, &lo) == 2)
+            {
+                seed_key[0] = hi;
+                seed_key[1] = lo;
+                seeded = true;
+            }
+            else if (sscanf(line, "%d", &key) == 1)
+                _journal_keys.push_back(key);
+        }
+        fclose(f);
+
+        if (!seeded)
+        {
+            end(1, false, "Journal (%s) has no seed line",
+                crawl_state.journal_replay.c_str());
+        }
+
+        seed_rng(seed_key, ARRAYSZ(seed_key));
+        _journal_replaying = true;
+        // Replay as fast as the terminal allows.
+        crawl_state.disables.set(DIS_DELAY);
+        return true;
+    }
+
+    if (!crawl_state.journal_record.empty())
+    {
+        uint64_t seed_key[2];
+        const bool got_urandom
+            = read_urandom((char*)seed_key, sizeof(seed_key));
+        ASSERT(got_urandom);
+
+        _journal_out = fopen_u(crawl_state.journal_record.c_str(), "w");
+        if (!_journal_out)
+        {
+            end(1, true, "Can't write journal (%s)",
+                crawl_state.journal_record.c_str());
+        }
+
+        seed_rng(seed_key, ARRAYSZ(seed_key));
+        fprintf(_journal_out, "seed %llx %llx\n",
+                (unsigned long long)seed_key[0],
+                (unsigned long long)seed_key[1]);
+        fflush(_journal_out);
+        return true;
+    }
+
+    return false;
+}
+
+static void _journal_record_keys(const keyseq &keys)
+{
+    if (!_journal_out)
+        return;
+    for (int key : keys)
+        fprintf(_journal_out, "%d\n", key);
+    // Flush per fetch, so a crash loses at most the fatal keystroke --
+    // crash reproduction is half the point of recording.
+    fflush(_journal_out);
+}
+
 /*
  * Reads as many keypresses as are available (waiting for at least one),
  * and returns them as a single keyseq.
@@ -699,6 +849,21 @@ static keyseq _getch_mul(int (*rgetch)() = nullptr)
     keyseq keys;
     int    a;
 
+    if (_journal_replaying)
+    {
+        if (!_journal_keys.empty())
+        {
+            keys.push_back(_journal_keys.front());
+            _journal_keys.pop_front();
+            return keys;
+        }
+        // Journal exhausted: hand the session back to the terminal for
+        // inspection.
+        _journal_replaying = false;
+        crawl_state.disables.set(DIS_DELAY, false);
+        mprf(MSGCH_PROMPT, "Journal replay finished.");
+    }
+
     // Something's gone wrong with replaying keys if crawl needs to
     // get new keys from the user.
     if (crawl_state.is_replaying_keys())
@@ -718,6 +883,8 @@ static keyseq _getch_mul(int (*rgetch)() = nullptr)
     while (kbhit() || a == 0)
         keys.push_back(a = rgetch());
 
+    _journal_record_keys(keys);
+
     return keys;
 }
 
@@ -49,6 +49,12 @@ void macro_add_query();
 void macro_init();
 void macro_save();
 
+// Input journal (-record / -replay); see macro.cc.
+bool journal_seed_rng();
+bool journal_replay_active();
+void journal_note_fixed_seed(uint32_t seed);
+uint32_t journal_replayed_fixed_seed();
+
 void macro_clear_buffers();
 
 void macro_userfn(const char *keys, const char *registryname);
@@ -52,6 +52,8 @@
 #include "crash.h"
 #include "dactions.h"
 #include "database.h"
+#include "dbg-mem.h"
+#include "dbg-perf.h"
 #include "dbg-scan.h"
 #include "dbg-util.h"
 #include "delay.h"
@@ -351,13 +353,14 @@ static void _reset_game()
     macro_clear_buffers();
     transit_lists_clear();
     you = player();
+    clear_item_name_cache();
     StashTrack = StashTracker();
     travel_cache = TravelCache();
     clear_level_target();
     you.clear_place_info();
     overview_clear();
     clear_message_window();
-    note_list.clear();
+    clear_notes();
     msg::deinitialise_mpr_streams();
 
 #ifdef USE_TILE_LOCAL
@@ -499,6 +502,8 @@ static void _show_commandline_options_help()
     puts("  -macro <dir>          directory to save/find macro.txt");
     puts("  -version              Crawl version (and compilation info)");
     puts("  -save-version <name>  Save file version for the given player");
+    puts("  -record <file>        journal the RNG seed and keys for -replay");
+    puts("  -replay <file>        replay a journal recorded with -record");
     puts("  -sprint               select Sprint");
     puts("  -sprint-map <name>    preselect a Sprint map");
     puts("  -tutorial             select the Tutorial");
@@ -788,7 +793,7 @@ static void _do_wizard_command(int wiz_command)
 
     // case 'n': break;
     // case 'N': break;
-    // case CONTROL('N'): break;
+    case CONTROL('N'): debug_memory_report(); break;
 
     case 'o': wizard_create_spec_object(); break;
     case 'O': debug_test_explore(); break;
@@ -821,7 +826,7 @@ static void _do_wizard_command(int wiz_command)
     case 'v': wizard_value_artefact(); break;
     case 'V': wizard_toggle_xray_vision(); break;
     case 'E': wizard_freeze_time(); break;
-    // case CONTROL('V'): break;
+    case CONTROL('V'): debug_dump_perf_stats(); break;
 
     case 'w': wizard_god_mollify(); break;
     case 'W': wizard_god_wrath(); break;
@@ -1445,6 +1450,11 @@ static void _input()
                 if (!clua.callfn("ready", 0, 0) && !clua.error.empty())
                     mprf(MSGCH_ERROR, "Lua error: %s", clua.error.c_str());
             }
+
+            // We're about to wait for input anyway: nudge the Lua heaps
+            // along now so collection doesn't burst mid-turn instead.
+            clua.gc_step();
+            dlua.gc_step();
         }
 
 #ifdef WATCHDOG
@@ -1884,6 +1894,10 @@ static void _do_rest()
 
     if (i_feel_safe())
     {
+        // The player is about to be idle for a while: a good moment to
+        // build the next level down, so descending later is a plain load.
+        pregenerate_next_level();
+
         if ((you.hp == you.hp_max || !player_regenerates_hp())
             && (you.magic_points == you.max_magic_points
                 || !player_regenerates_mp()))
@@ -2470,9 +2484,14 @@ static void _update_still_winds()
 
 void world_reacts()
 {
+    perf_phase_timer world_timer(PERF_WORLD_REACTS);
+
     // All markers should be activated at this point.
     ASSERT(!env.markers.need_activate());
 
+    // Monsters and clouds are about to move.
+    invalidate_travel_distance_cache();
+
     fire_final_effects();
 
     if (crawl_state.viewport_monster_hp || crawl_state.viewport_weapons)
@@ -2509,11 +2528,17 @@ void world_reacts()
     run_environment_effects();
 
     if (!crawl_state.game_is_arena())
+    {
+        perf_phase_timer timer(PERF_PLAYER_REACTS);
         player_reacts();
+    }
 
     abyss_morph();
     apply_noises();
-    handle_monsters(true);
+    {
+        perf_phase_timer timer(PERF_MONSTER_TURNS);
+        handle_monsters(true);
+    }
 
     _check_banished();
 
@@ -2538,18 +2563,24 @@ void world_reacts()
         ouch(INSTANT_DEATH, KILLED_BY_QUITTING);
     }
 
-    handle_time();
-    manage_clouds();
-    if (env.level_state & LSTATE_GLOW_MOLD)
-        _update_mold();
-    if (env.level_state & LSTATE_GOLUBRIA)
-        _update_golubria_traps();
-    if (env.level_state & LSTATE_STILL_WINDS)
-        _update_still_winds();
+    {
+        perf_phase_timer timer(PERF_TIMED_EFFECTS);
+        handle_time();
+        manage_clouds();
+        if (env.level_state & LSTATE_GLOW_MOLD)
+            _update_mold();
+        if (env.level_state & LSTATE_GOLUBRIA)
+            _update_golubria_traps();
+        if (env.level_state & LSTATE_STILL_WINDS)
+            _update_still_winds();
+    }
     if (!crawl_state.game_is_arena())
         player_reacts_to_monsters();
 
-    viewwindow();
+    {
+        perf_phase_timer timer(PERF_VIEWWINDOW);
+        viewwindow();
+    }
 
     if (you.cannot_act() && any_messages()
         && crawl_state.repeat_cmd != CMD_WIZARD)
@@ -2573,8 +2604,11 @@ void world_reacts()
         update_turn_count();
         msgwin_new_turn();
         crawl_state.lua_calls_no_turn = 0;
-        if (crawl_state.game_is_sprint()
-            && !(you.num_turns % 256)
+        // Checkpoint periodically, so a crash or host reboot loses at
+        // most this many turns rather than everything back to the last
+        // stair transition. Checkpoint saves skip unchanged chunks, so
+        // this is cheap enough to do in every game mode.
+        if (!(you.num_turns % 256)
             && !you_are_delayed()
             && !crawl_state.disables[DIS_SAVE_CHECKPOINTS])
         {
@@ -2582,6 +2616,8 @@ void world_reacts()
             save_game(false);
         }
     }
+
+    perf_end_turn();
 }
 
 static command_type _get_next_cmd()
@@ -151,14 +151,18 @@ static weapon_type _determine_weapon_subtype(int item_level)
     }
     else if (x_chance_in_y(item_level, 20))
     {
-        // Pick a weapon based on rarity.
-        while (true)
+        // Pick a weapon based on rarity. Same distribution as rerolling
+        // random types until one passes a rarity-in-10 check, but drawn
+        // directly from a weight table built on first use.
+        static vector<pair<weapon_type, int>> rarity_weights;
+        if (rarity_weights.empty())
         {
-            const int wpntype = random2(NUM_WEAPONS);
-
-            if (x_chance_in_y(weapon_rarity(wpntype), 10))
-                return static_cast<weapon_type>(wpntype);
+            for (int wpntype = 0; wpntype < NUM_WEAPONS; ++wpntype)
+                if (const int rarity = weapon_rarity(wpntype))
+                    rarity_weights.emplace_back(static_cast<weapon_type>(wpntype),
+                                                rarity);
         }
+        return *random_choose_weighted(rarity_weights);
     }
     else if (x_chance_in_y(item_level, item_level+7))
     {
@@ -1570,11 +1574,8 @@ static void _generate_staff_item(item_def& item, bool allow_uniques,
 
     if (force_type == OBJ_RANDOM)
     {
-        do
-        {
-            item.sub_type = random2(NUM_STAVES);
-        }
-        while (item_type_removed(OBJ_STAVES, item.sub_type));
+        item.sub_type = random_subtype_not_removed(OBJ_STAVES, 0,
+                                                   NUM_STAVES - 1);
 
         // staves of energy are 25% less common, wizardry/power
         // are more common
@@ -1591,13 +1592,7 @@ static void _generate_staff_item(item_def& item, bool allow_uniques,
 static void _generate_rod_item(item_def& item, int force_type, int item_level)
 {
     if (force_type == OBJ_RANDOM)
-    {
-        do
-        {
-            item.sub_type = random2(NUM_RODS);
-        }
-        while (item_type_removed(OBJ_RODS, item.sub_type));
-    }
+        item.sub_type = random_subtype_not_removed(OBJ_RODS, 0, NUM_RODS - 1);
     else
         item.sub_type = force_type;
 
@@ -2163,15 +2158,10 @@ static bool _armour_is_visibly_special(const item_def &item)
 
 jewellery_type get_random_amulet_type()
 {
-    int res;
-    do
-    {
-        res = random_range(AMU_FIRST_AMULET, NUM_JEWELLERY - 1);
-    }
-    // Do not generate removed item types.
-    while (item_type_removed(OBJ_JEWELLERY, res));
-
-    return jewellery_type(res);
+    // Does not generate removed item types.
+    return jewellery_type(random_subtype_not_removed(OBJ_JEWELLERY,
+                                                     AMU_FIRST_AMULET,
+                                                     NUM_JEWELLERY - 1));
 }
 
 static jewellery_type _get_raw_random_ring_type()
@@ -2179,10 +2169,11 @@ static jewellery_type _get_raw_random_ring_type()
     jewellery_type ring;
     do
     {
-        ring = (jewellery_type)(random_range(RING_FIRST_RING, NUM_RINGS - 1));
+        ring = (jewellery_type)random_subtype_not_removed(OBJ_JEWELLERY,
+                                                          RING_FIRST_RING,
+                                                          NUM_RINGS - 1);
     }
-    while (ring == RING_TELEPORTATION && crawl_state.game_is_sprint()
-           || item_type_removed(OBJ_JEWELLERY, ring));
+    while (ring == RING_TELEPORTATION && crawl_state.game_is_sprint());
     return ring;
 }
 
@@ -28,21 +28,14 @@ void set_terrain_mapped(const coord_def gc)
 
 int count_detected_mons()
 {
-    int count = 0;
-    for (rectangle_iterator ri(BOUNDARY_BORDER - 1); ri; ++ri)
+    // Don't expose new dug out areas:
+    // Note: assumptions are being made here about how
+    // terrain can change (eg it used to be solid, and
+    // thus monster/item free).
+    return env.map_knowledge.count_if([](const map_cell &cell)
     {
-        // Don't expose new dug out areas:
-        // Note: assumptions are being made here about how
-        // terrain can change (eg it used to be solid, and
-        // thus monster/item free).
-        if (env.map_knowledge(*ri).changed())
-            continue;
-
-        if (env.map_knowledge(*ri).detected_monster())
-            count++;
-    }
-
-    return count;
+        return !cell.changed() && cell.detected_monster();
+    });
 }
 
 void clear_map(bool clear_items, bool clear_mons)
@@ -54,16 +47,36 @@ void clear_map(bool clear_items, bool clear_mons)
         if (!cell.known() || cell.visible())
             continue;
 
-        cell.clear_cloud();
+        // Only touch the display layers for cells that actually lose
+        // something. Detection effects call this for the whole level,
+        // and redrawing every known cell made them by far the biggest
+        // frames webtiles ever sends.
+        bool cleared = false;
+
+        if (cell.cloud() != CLOUD_NONE)
+        {
+            cell.clear_cloud();
+            cleared = true;
+        }
 
-        if (clear_items)
+        if (clear_items && cell.item())
+        {
             cell.clear_item();
+            cleared = true;
+        }
 
-        if (clear_mons && !mons_class_is_stationary(cell.monster()))
+        if (clear_mons && cell.monster() != MONS_NO_MONSTER
+            && !mons_class_is_stationary(cell.monster()))
+        {
             cell.clear_monster();
+            cleared = true;
+        }
 
 #ifdef USE_TILE
-        tile_reset_fg(p);
+        if (cleared)
+            tile_reset_fg(p);
+#else
+        UNUSED(cleared);
 #endif
     }
 }
@@ -250,15 +263,15 @@ bool map_cell::update_cloud_state()
         return false; // we're already up-to-date
 
     // player non-opaque clouds vanish instantly out of los
-    if (_cloud && _cloud->killer == KILL_YOU_MISSILE
-        && !is_opaque_cloud(_cloud->type))
+    if (_cloud.type != CLOUD_NONE && _cloud.killer == KILL_YOU_MISSILE
+        && !is_opaque_cloud(_cloud.type))
     {
         clear_cloud();
         return true;
     }
 
     // still winds KOs all clouds, even those out of LOS
-    if (_cloud && env.level_state & LSTATE_STILL_WINDS)
+    if (_cloud.type != CLOUD_NONE && env.level_state & LSTATE_STILL_WINDS)
     {
         clear_cloud();
         return true;
@@ -64,15 +64,16 @@ struct cloud_info
 struct map_cell
 {
     map_cell() : flags(0), _feat(DNGN_UNSEEN), _feat_colour(0),
-                 _trap(TRAP_UNASSIGNED), _cloud(0), _item(0), _mons(0)
+                 _trap(TRAP_UNASSIGNED), _item(0), _mons(0)
     {
     }
 
     map_cell(const map_cell& c)
     {
-        memcpy(this, &c, sizeof(map_cell));
-        if (_cloud)
-            _cloud = new cloud_info(*_cloud);
+        // The void* cast keeps gcc from objecting to the blockwise copy;
+        // everything in here is safe to memcpy, the owned pointers are
+        // re-cloned just below.
+        memcpy(static_cast<void*>(this), &c, sizeof(map_cell));
         if (_mons)
             _mons = new monster_info(*_mons);
         if (_item)
@@ -81,8 +82,6 @@ struct map_cell
 
     ~map_cell()
     {
-        if (_cloud)
-            delete _cloud;
         if (!(flags & MAP_DETECTED_MONSTER) && _mons)
             delete _mons;
         if (_item)
@@ -93,15 +92,11 @@ struct map_cell
     {
         if (&c == this)
             return *this;
-        if (_cloud)
-            delete _cloud;
         if (_mons)
             delete _mons;
         if (_item)
             delete _item;
-        memcpy(this, &c, sizeof(map_cell));
-        if (_cloud)
-            _cloud = new cloud_info(*_cloud);
+        memcpy(static_cast<void*>(this), &c, sizeof(map_cell));
         if (_mons)
             _mons = new monster_info(*_mons);
         if (_item)
@@ -234,39 +229,35 @@ struct map_cell
 
     cloud_type cloud() const
     {
-        if (_cloud)
-            return _cloud->type;
-        else
-            return CLOUD_NONE;
+        return _cloud.type;
     }
 
     unsigned cloud_colour() const
     {
-        if (_cloud)
-            return _cloud->colour;
+        if (_cloud.type != CLOUD_NONE)
+            return _cloud.colour;
         else
             return 0;
     }
 
-    cloud_info* cloudinfo() const
+    cloud_info* cloudinfo()
+    {
+        return _cloud.type != CLOUD_NONE ? &_cloud : nullptr;
+    }
+
+    const cloud_info* cloudinfo() const
     {
-        return _cloud;
+        return _cloud.type != CLOUD_NONE ? &_cloud : nullptr;
     }
 
     void set_cloud(const cloud_info& ci)
     {
-        if (_cloud)
-            delete _cloud;
-        _cloud = new cloud_info(ci);
+        _cloud = ci;
     }
 
     void clear_cloud()
     {
-        if (_cloud)
-        {
-            delete _cloud;
-            _cloud = 0;
-        }
+        _cloud = cloud_info();
     }
 
     bool update_cloud_state();
@@ -307,7 +298,11 @@ private:
     dungeon_feature_type _feat:8;
     colour_t _feat_colour;
     trap_type _trap:8;
-    cloud_info* _cloud;
+    // Stored inline: it's barely bigger than the pointer was, and it
+    // spares a heap allocation per cell with a cloud. Monster and item
+    // knowledge stay out of line — monster_info in particular is far
+    // too big to burn GXM*GYM copies of.
+    cloud_info _cloud;
     item_info* _item;
     monster_info* _mons;
 };
@@ -2398,6 +2398,20 @@ void map_def::strip()
     feat_renames.clear();
 }
 
+// Compile all Lua fragments down to bytecode, so the cached form of this
+// map is loaded via lua_load instead of being re-parsed in every game.
+// Fragments that fail to compile keep their source form; the error will
+// be reported as usual when the map is actually used.
+void map_def::compile_lua_chunks(CLua &interp)
+{
+    prelude.compile(interp);
+    mapchunk.compile(interp);
+    main.compile(interp);
+    validate.compile(interp);
+    veto.compile(interp);
+    epilogue.compile(interp);
+}
+
 void map_def::load()
 {
     if (!index_only)
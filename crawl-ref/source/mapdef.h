@@ -1188,6 +1188,7 @@ public:
 
     void load();
     void strip();
+    void compile_lua_chunks(CLua &interp);
 
     int weight(const level_id &lid) const;
     map_chance chance(const level_id &lid) const;
@@ -1014,6 +1014,7 @@ void map_markers::activate_markers_at(coord_def p)
 void map_markers::add(map_marker *marker)
 {
     markers.insert(dgn_pos_marker(marker->pos, marker));
+    markers_by_type[marker->get_type()].push_back(marker);
     have_inactive_markers = true;
 }
 
@@ -1028,6 +1029,16 @@ void map_markers::unlink_marker(const map_marker *marker)
             break;
         }
     }
+
+    vector<map_marker *> &typed = markers_by_type[marker->get_type()];
+    for (auto i = typed.begin(); i != typed.end(); ++i)
+    {
+        if (*i == marker)
+        {
+            typed.erase(i);
+            break;
+        }
+    }
 }
 
 void map_markers::check_empty()
@@ -1047,16 +1058,12 @@ void map_markers::remove_markers_at(const coord_def &c,
                                     map_marker_type type)
 {
     auto els = markers.equal_range(c);
-    for (auto i = els.first; i != els.second;)
-    {
-        auto todel = i++;
-        if (type == MAT_ANY || todel->second->get_type() == type)
-        {
-            delete todel->second;
-            markers.erase(todel);
-        }
-    }
-    check_empty();
+    vector<map_marker *> doomed;
+    for (auto i = els.first; i != els.second; ++i)
+        if (type == MAT_ANY || i->second->get_type() == type)
+            doomed.push_back(i->second);
+    for (map_marker *marker : doomed)
+        remove(marker);
 }
 
 map_marker *map_markers::find(const coord_def &c, map_marker_type type)
@@ -1070,11 +1077,13 @@ map_marker *map_markers::find(const coord_def &c, map_marker_type type)
 
 map_marker *map_markers::find(map_marker_type type)
 {
-    for (const auto &entry : markers)
-        if (type == MAT_ANY || entry.second->get_type() == type)
-            return entry.second;
+    if (type != MAT_ANY)
+    {
+        const vector<map_marker *> &typed = markers_by_type[type];
+        return typed.empty() ? nullptr : typed[0];
+    }
 
-    return nullptr;
+    return markers.empty() ? nullptr : markers.begin()->second;
 }
 
 void map_markers::move(const coord_def &from, const coord_def &to)
@@ -1083,15 +1092,12 @@ void map_markers::move(const coord_def &from, const coord_def &to)
     auto els = markers.equal_range(from);
 
     list<map_marker*> tmarkers;
-    for (auto i = els.first; i != els.second;)
-    {
-        auto curr = i++;
-        tmarkers.push_back(curr->second);
-        markers.erase(curr);
-    }
+    for (auto i = els.first; i != els.second; ++i)
+        tmarkers.push_back(i->second);
 
     for (auto mark : tmarkers)
     {
+        unlink_marker(mark);
         mark->pos = to;
         add(mark);
     }
@@ -1107,12 +1113,12 @@ void map_markers::move_marker(map_marker *marker, const coord_def &to)
 
 vector<map_marker*> map_markers::get_all(map_marker_type mat)
 {
+    if (mat != MAT_ANY)
+        return markers_by_type[mat];
+
     vector<map_marker*> rmarkers;
     for (const auto &entry : markers)
-    {
-        if (mat == MAT_ANY || entry.second->get_type() == mat)
-            rmarkers.push_back(entry.second);
-    }
+        rmarkers.push_back(entry.second);
     return rmarkers;
 }
 
@@ -1120,13 +1126,17 @@ vector<map_marker*> map_markers::get_all(const string &key, const string &val)
 {
     vector<map_marker*> rmarkers;
 
-    for (const auto &entry : markers)
+    // Only Lua and wizmode property markers can answer property queries;
+    // every other marker type inherits the empty default.
+    for (map_marker_type mat : { MAT_LUA_MARKER, MAT_WIZ_PROPS })
     {
-        map_marker*  marker = entry.second;
-        const string prop   = marker->property(key);
+        for (map_marker *marker : markers_by_type[mat])
+        {
+            const string prop = marker->property(key);
 
-        if (val.empty() && !prop.empty() || !val.empty() && val == prop)
-            rmarkers.push_back(marker);
+            if (val.empty() && !prop.empty() || !val.empty() && val == prop)
+                rmarkers.push_back(marker);
+        }
     }
 
     return rmarkers;
@@ -1159,6 +1169,8 @@ void map_markers::clear()
     for (auto &entry : markers)
         delete entry.second;
     markers.clear();
+    for (vector<map_marker *> &typed : markers_by_type)
+        typed.clear();
     check_empty();
 }
 
@@ -1197,7 +1209,13 @@ void map_markers::read(reader &inf)
         // used by tools
         unmarshallInt(inf);
         if (map_marker *mark = map_marker::read_marker(inf))
-            add(mark);
+        {
+            // write() emits markers in map order, so appending with an
+            // end hint rebuilds the multimap in linear time.
+            markers.insert(markers.end(), dgn_pos_marker(mark->pos, mark));
+            markers_by_type[mark->get_type()].push_back(mark);
+            have_inactive_markers = true;
+        }
     }
 }
 
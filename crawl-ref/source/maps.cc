@@ -20,6 +20,7 @@
 #include "coord.h"
 #include "coordit.h"
 #include "dbg-maps.h"
+#include "dbg-perf.h"
 #include "dungeon.h"
 #include "end.h"
 #include "endianness.h"
@@ -91,6 +92,19 @@ dgn_map_parameters::dgn_map_parameters(const string_vector &parameters)
 
 // Make sure that vault_n, where n is a number, is a vault which can be put
 // anywhere, while other vault names are for specific level ranges, etc.
+// Placement cost per map for the current builder() run; see maps.h.
+static map<string, map_build_profile> _build_profiles;
+
+const map<string, map_build_profile> &mapgen_build_profiles()
+{
+    return _build_profiles;
+}
+
+void clear_mapgen_build_profiles()
+{
+    _build_profiles.clear();
+}
+
 map_section_type vault_main(vault_placement &place, const map_def *vault,
                             bool check_place)
 {
@@ -103,7 +117,23 @@ map_section_type vault_main(vault_placement &place, const map_def *vault,
     // level, except for branch entry vaults where dungeon.cc just
     // rejects the vault and places a vanilla entry.
 
-    return _write_vault(const_cast<map_def&>(*vault), place, check_place);
+    // Time the attempt, so slow vaults show up both in the wizmode
+    // levgen dump and in mapstat runs before they ship.
+    const int64_t start_micros = perf_now_micros();
+    const map_section_type result =
+        _write_vault(const_cast<map_def&>(*vault), place, check_place);
+    const int64_t elapsed = perf_now_micros() - start_micros;
+
+    map_build_profile &prof = _build_profiles[vault->name];
+    prof.tries++;
+    prof.micros += elapsed;
+
+#ifdef DEBUG_STATISTICS
+    if (crawl_state.map_stat_gen)
+        mapstat_report_map_timing(*vault, elapsed);
+#endif
+
+    return result;
 }
 
 static map_section_type _write_vault(map_def &mdef,
@@ -127,7 +157,10 @@ static map_section_type _write_vault(map_def &mdef,
         clear_subvault_stack();
 
         if (place.map.test_lua_veto())
+        {
+            _build_profiles[place.map.name].vetoes++;
             break;
+        }
 
         if (!_resolve_map(place.map))
             continue;
@@ -748,6 +781,9 @@ private:
 
 public:
     bool accept(const map_def &md) const;
+    bool accept_static(const map_def &md) const;
+    bool accept_dynamic(const map_def &md) const;
+    string cache_key() const;
     void announce(const map_def *map) const;
 
     bool valid() const
@@ -827,8 +863,7 @@ bool map_selector::depth_selectable(const map_def &mapdef) const
            && !mapdef.has_tag("tutorial")
            && (!mapdef.has_tag_prefix("temple_")
                || mapdef.has_tag_prefix("uniq_altar_"))
-           && _map_matches_species(mapdef)
-           && (!check_layout || _map_matches_layout_type(mapdef));
+           && _map_matches_species(mapdef);
 }
 
 static bool _is_extra_compatible(maybe_bool want_extra, bool have_extra)
@@ -839,6 +874,14 @@ static bool _is_extra_compatible(maybe_bool want_extra, bool have_extra)
 }
 
 bool map_selector::accept(const map_def &mapdef) const
+{
+    return accept_static(mapdef) && accept_dynamic(mapdef);
+}
+
+// The half of accept() that depends only on the map definition and the
+// selector itself. Results may be memoised for as long as the loaded map
+// definitions and the current game (species, game type) stay the same.
+bool map_selector::accept_static(const map_def &mapdef) const
 {
     switch (sel)
     {
@@ -851,9 +894,7 @@ bool map_selector::accept(const map_def &mapdef) const
         }
         return mapdef.is_minivault() == mini
                && _is_extra_compatible(extra, mapdef.has_tag("extra"))
-               && mapdef.place.is_usable_in(place)
-               && _map_matches_layout_type(mapdef)
-               && !mapdef.map_already_used();
+               && mapdef.place.is_usable_in(place);
 
     case DEPTH:
     {
@@ -861,8 +902,7 @@ bool map_selector::accept(const map_def &mapdef) const
         return mapdef.is_minivault() == mini
                && _is_extra_compatible(extra, mapdef.has_tag("extra"))
                && (!chance.valid() || chance.dummy_chance())
-               && depth_selectable(mapdef)
-               && !mapdef.map_already_used();
+               && depth_selectable(mapdef);
     }
 
     case DEPTH_AND_CHANCE:
@@ -872,8 +912,7 @@ bool map_selector::accept(const map_def &mapdef) const
         return chance.valid()
                && !chance.dummy_chance()
                && depth_selectable(mapdef)
-               && _is_extra_compatible(extra, mapdef.has_tag("extra"))
-               && !mapdef.map_already_used();
+               && _is_extra_compatible(extra, mapdef.has_tag("extra"));
     }
 
     case TAG:
@@ -881,8 +920,28 @@ bool map_selector::accept(const map_def &mapdef) const
                && (!check_depth
                    || !mapdef.has_depth()
                    || mapdef.is_usable_in(place))
-               && _map_matches_species(mapdef)
-               && _map_matches_layout_type(mapdef)
+               && _map_matches_species(mapdef);
+
+    default:
+        return false;
+    }
+}
+
+// The cheap, level-state dependent half of accept(): layout tags have to
+// match the current level's layout and the map mustn't have been placed
+// already.
+bool map_selector::accept_dynamic(const map_def &mapdef) const
+{
+    switch (sel)
+    {
+    case PLACE:
+    case TAG:
+        return _map_matches_layout_type(mapdef)
+               && !mapdef.map_already_used();
+
+    case DEPTH:
+    case DEPTH_AND_CHANCE:
+        return (!check_layout || _map_matches_layout_type(mapdef))
                && !mapdef.map_already_used();
 
     default:
@@ -890,6 +949,17 @@ bool map_selector::accept(const map_def &mapdef) const
     }
 }
 
+// Identifies all game-static inputs to accept_static(). Vault lists
+// memoised under this key stay valid until the map definitions change.
+string map_selector::cache_key() const
+{
+    return make_stringf("%d:%s:%s:%d:%d:%d:%d:%d",
+                        static_cast<int>(sel), place.describe().c_str(),
+                        tag.c_str(), mini, static_cast<int>(extra),
+                        check_depth, static_cast<int>(you.species),
+                        crawl_state.game_is_tutorial());
+}
+
 void map_selector::announce(const map_def *vault) const
 {
 #ifdef DEBUG_DIAGNOSTICS
@@ -930,17 +1000,39 @@ string vault_chance_tag(const map_def &map)
 
 typedef vector<unsigned> vault_indices;
 
+// Memoised results of the static half of the selector filter, so repeated
+// selections (and builder restarts after vetoes) don't rescan all of vdefs
+// evaluating tag and depth matches every time. Invalidated whenever the
+// map definitions change.
+static map<string, vault_indices> _eligible_map_cache;
+
+static void _clear_eligible_map_cache()
+{
+    _eligible_map_cache.clear();
+}
+
 static vault_indices _eligible_maps_for_selector(const map_selector &sel)
 {
     vault_indices eligible;
 
-    if (sel.valid())
+    if (!sel.valid())
+        return eligible;
+
+    const string key = sel.cache_key();
+    auto cached = _eligible_map_cache.find(key);
+    if (cached == _eligible_map_cache.end())
     {
+        vault_indices statics;
         for (unsigned i = 0, size = vdefs.size(); i < size; ++i)
-            if (sel.accept(vdefs[i]))
-                eligible.push_back(i);
+            if (sel.accept_static(vdefs[i]))
+                statics.push_back(i);
+        cached = _eligible_map_cache.insert(make_pair(key, statics)).first;
     }
 
+    for (unsigned i : cached->second)
+        if (sel.accept_dynamic(vdefs[i]))
+            eligible.push_back(i);
+
     return eligible;
 }
 
@@ -1161,6 +1253,27 @@ int map_count()
     return vdefs.size();
 }
 
+// Rough heap footprint of the loaded vault definitions, for the
+// wizmode memory report. Unrealised maps keep their Lua on disk, so
+// this mostly measures names, tags and whatever main chunks have been
+// pulled in from the map cache.
+size_t map_memory_used()
+{
+    size_t bytes = vdefs.capacity() * sizeof(map_def);
+    for (const map_def &mapdef : vdefs)
+    {
+        bytes += mapdef.name.capacity() + mapdef.description.capacity()
+                 + mapdef.tags.capacity()
+                 + mapdef.prelude.estimate_size()
+                 + mapdef.mapchunk.estimate_size()
+                 + mapdef.main.estimate_size()
+                 + mapdef.validate.estimate_size()
+                 + mapdef.veto.estimate_size()
+                 + mapdef.epilogue.estimate_size();
+    }
+    return bytes;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // Reading maps from .des files.
 
@@ -1241,11 +1354,6 @@ static bool verify_file_version(const string &file, time_t mtime)
     }
 }
 
-static bool _verify_map_index(const string &base, time_t mtime)
-{
-    return verify_file_version(base + ".idx", mtime);
-}
-
 static bool _verify_map_full(const string &base, time_t mtime)
 {
     return verify_file_version(base + ".dsc", mtime);
@@ -1276,7 +1384,7 @@ static bool _load_map_index(const string& cache, const string &base,
 
     FILE* fp = fopen_u((base + ".idx").c_str(), "rb");
     if (!fp)
-        end(1, true, "Unable to read %s", (base + ".idx").c_str());
+        return false;
 
     reader inf(fp, TAG_MINOR_VERSION);
     // Re-check version, might have been modified in the meantime.
@@ -1299,6 +1407,7 @@ static bool _load_map_index(const string& cache, const string &base,
     const int nmaps = unmarshallShort(inf);
     const int nexist = vdefs.size();
     vdefs.resize(nexist + nmaps, map_def());
+    _clear_eligible_map_cache();
     for (int i = 0; i < nmaps; ++i)
     {
         map_def &vdef(vdefs[nexist + i]);
@@ -1315,6 +1424,23 @@ static bool _load_map_index(const string& cache, const string &base,
     return true;
 }
 
+// The actual cache probe and load; the caller must hold the cache's
+// lock file in some mode.
+static bool _load_map_cache_locked(const string &filename,
+                                   const string &descache_base,
+                                   const string &cachename)
+{
+    time_t mtime = file_modtime(filename);
+
+    // The index loader re-validates the .idx header itself (and falls
+    // back cleanly if the file is missing or stale), so only the .dsc
+    // needs probing here.
+    if (!_verify_map_full(descache_base, mtime))
+        return false;
+
+    return _load_map_index(cachename, descache_base, mtime);
+}
+
 static bool _load_map_cache(const string &filename, const string &cachename)
 {
     _check_des_index_dir();
@@ -1322,18 +1448,7 @@ static bool _load_map_cache(const string &filename, const string &cachename)
 
     file_lock deslock(descache_base + ".lk", "rb", false);
 
-    time_t mtime = file_modtime(filename);
-    string file_idx = descache_base + ".idx";
-    string file_dsc = descache_base + ".dsc";
-
-    // What's the point in checking these twice (here and in load_ma_index)?
-    if (!_verify_map_index(descache_base, mtime)
-        || !_verify_map_full(descache_base, mtime))
-    {
-        return false;
-    }
-
-    return _load_map_index(cachename, descache_base, mtime);
+    return _load_map_cache_locked(filename, descache_base, cachename);
 }
 
 static void _write_map_prelude(const string &filebase, time_t mtime)
@@ -1345,6 +1460,8 @@ static void _write_map_prelude(const string &filebase, time_t mtime)
         return;
     }
 
+    lc_global_prelude.compile(dlua);
+
     FILE *fp = fopen_u(luafile.c_str(), "wb");
     writer outf(luafile, fp);
     marshallUByte(outf, TAG_MAJOR_VERSION);
@@ -1369,7 +1486,13 @@ static void _write_map_full(const string &filebase, size_t vs, size_t ve,
     marshallByte(outf, WORD_LEN);
     marshallSigned(outf, mtime);
     for (size_t i = vs; i < ve; ++i)
+    {
+        // Store bytecode rather than source, so placement attempts in
+        // later games skip the Lua parser. The prelude lands in the
+        // index afterwards and benefits too.
+        vdefs[i].compile_lua_chunks(dlua);
         vdefs[i].write_full(outf);
+    }
     fclose(fp);
 }
 
@@ -1398,15 +1521,12 @@ static void _write_map_index(const string &filebase, size_t vs, size_t ve,
     fclose(fp);
 }
 
+// The caller must hold the cache's write lock.
 static void _write_map_cache(const string &filename, size_t vs, size_t ve,
                              time_t mtime)
 {
-    _check_des_index_dir();
-
     const string descache_base = get_descache_path(filename, "");
 
-    file_lock deslock(descache_base + ".lk", "wb");
-
     _write_map_prelude(descache_base, mtime);
     _write_map_full(descache_base, vs, ve, mtime);
     _write_map_index(descache_base, vs, ve, mtime);
@@ -1423,6 +1543,18 @@ static void _parse_maps(const string &s)
     if (_load_map_cache(s, cache_name))
         return;
 
+    // Cold cache. Take the exclusive cache lock *before* parsing and
+    // probe again: when many games launch against a fresh deploy, the
+    // first process in rebuilds the cache while the rest block here and
+    // then load its output, instead of every process re-parsing the des
+    // file only to overwrite the same cache in turn.
+    _check_des_index_dir();
+    const string descache_base = get_descache_path(cache_name, "");
+    file_lock deslock(descache_base + ".lk", "wb");
+
+    if (_load_map_cache_locked(s, descache_base, cache_name))
+        return;
+
     FILE *dat = fopen_u(s.c_str(), "r");
     if (!dat)
         end(1, true, "Failed to open %s for reading", s.c_str());
@@ -1469,6 +1601,10 @@ void read_maps()
             brdepth[it->id] = it->numlevels;
         dlua.execfile("dlua/sanity.lua", true, true);
     }
+
+    // All des caches are loaded now; give back the slack that the
+    // geometric growth of vdefs (one resize per cache file) left behind.
+    vdefs.shrink_to_fit();
 }
 
 // If a .dsc file has been changed under the running Crawl, discard
@@ -1483,6 +1619,7 @@ void reread_maps()
 
     // BOOM!
     vdefs.clear();
+    _clear_eligible_map_cache();
     map_files_read.clear();
     read_maps();
 }
@@ -1502,6 +1639,7 @@ void add_parsed_map(const map_def &md)
 
     map.fixup();
     vdefs.push_back(map);
+    _clear_eligible_map_cache();
 }
 
 void run_map_global_preludes()
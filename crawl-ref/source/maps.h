@@ -28,6 +28,22 @@ coord_def find_portal_place(const vault_placement *place, bool check_place);
 const map_def *map_by_index(int index);
 void strip_all_maps();
 int map_count();
+size_t map_memory_used();
+
+// Per-map placement cost collected over the most recent builder() run,
+// for the wizmode level-generation dump. Collection is always on; the
+// cost is two clock reads per placement attempt.
+struct map_build_profile
+{
+    map_build_profile() : tries(0), vetoes(0), micros(0) { }
+
+    int     tries;   // placement attempts
+    int     vetoes;  // attempts the map's Lua veto hook rejected
+    int64_t micros;  // cumulative placement time
+};
+
+const map<string, map_build_profile> &mapgen_build_profiles();
+void clear_mapgen_build_profiles();
 
 string vault_chance_tag(const map_def &map);
 
@@ -3547,7 +3547,7 @@ int melee_attack::calc_your_to_hit_unarmed(int uattack)
     if (you.species != SP_VAMPIRE && you.hunger_state <= HS_STARVING)
         your_to_hit -= 3;
 
-    your_to_hit += slaying_bonus();
+    your_to_hit += attacker_slaying_bonus(false);
 
     return your_to_hit;
 }
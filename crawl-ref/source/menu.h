@@ -106,6 +106,12 @@ public:
     vector<tile_def> tiles;
 #endif
 
+private:
+    // Cached menu_colour() verdict; see highlight_colour().
+    mutable string _colour_cache_text;
+    mutable int    _cached_colour;
+    mutable bool   _colour_cached;
+
 public:
     MenuEntry(const string &txt = string(),
                MenuEntryLevel lev = MEL_ITEM,
@@ -113,7 +119,8 @@ public:
                int hotk = 0,
                bool preselect = false) :
         text(txt), quantity(qty), selected_qty(0), colour(-1),
-        hotkeys(), level(lev), preselected(preselect), data(nullptr)
+        hotkeys(), level(lev), preselected(preselect), data(nullptr),
+        _cached_colour(-1), _colour_cached(false)
     {
         colour = (lev == MEL_ITEM     ?  MENU_ITEM_STOCK_COLOUR :
                   lev == MEL_SUBTITLE ?  BLUE  :
@@ -121,6 +128,27 @@ public:
         if (hotk)
             hotkeys.push_back(hotk);
     }
+
+    // Move-aware overload: entry text is overwhelmingly built from
+    // make_stringf() temporaries, so adopt the buffer instead of
+    // copying it. No default for txt, or zero-argument construction
+    // would be ambiguous with the copying overload above.
+    MenuEntry(string &&txt,
+              MenuEntryLevel lev = MEL_ITEM,
+              int qty  = 0,
+              int hotk = 0,
+              bool preselect = false) :
+        text(move(txt)), quantity(qty), selected_qty(0), colour(-1),
+        hotkeys(), level(lev), preselected(preselect), data(nullptr),
+        _cached_colour(-1), _colour_cached(false)
+    {
+        colour = (lev == MEL_ITEM     ?  MENU_ITEM_STOCK_COLOUR :
+                  lev == MEL_SUBTITLE ?  BLUE  :
+                                         WHITE);
+        if (hotk)
+            hotkeys.push_back(hotk);
+    }
+
     virtual ~MenuEntry() { }
 
     bool operator<(const MenuEntry& rhs) const
@@ -159,7 +187,20 @@ public:
 
     virtual int highlight_colour() const
     {
-        return menu_colour(get_text(), "", tag);
+        // menu_colour() runs every pattern in menu_colour_mappings
+        // against the entry, and gets called for each visible entry on
+        // every redraw; for big menus that dominates repaint time.
+        // Remember the verdict until the entry's text changes (the
+        // string compare is far cheaper than the pattern matching, and
+        // needs no explicit invalidation).
+        const string txt = get_text();
+        if (!_colour_cached || _colour_cache_text != txt)
+        {
+            _cached_colour = menu_colour(txt, "", tag);
+            _colour_cache_text = txt;
+            _colour_cached = true;
+        }
+        return _cached_colour;
     }
 
     virtual bool selected() const
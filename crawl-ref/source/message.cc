@@ -66,10 +66,26 @@ struct message_particle
 {
     string text;        /// text of message (tagged string...)
     int repeats;        /// Number of times the message is in succession (x2)
+    string pure;        /// text with the formatting tags stripped
+    int pure_width;     /// strwidth(pure)
 
-    string pure_text() const
+    // The tag-stripped text is consulted on every merge attempt and
+    // length check, so strip it once up front rather than reparsing the
+    // markup each time.
+    message_particle(string txt, int rep)
+        : text(move(txt)), repeats(rep),
+          pure(formatted_string::parse_string(text).tostring()),
+          pure_width(strwidth(pure))
     {
-        return formatted_string::parse_string(text).tostring();
+    }
+
+    message_particle() : repeats(0), pure_width(0)
+    {
+    }
+
+    const string &pure_text() const
+    {
+        return pure;
     }
 
     string with_repeats() const
@@ -89,6 +105,12 @@ struct message_particle
         return pure_text() + rep;
     }
 
+    int pure_width_with_repeats() const
+    {
+        return repeats > 1 ? strwidth(pure_text_with_repeats())
+                           : pure_width;
+    }
+
     /**
      * If this is followed by another message particle on the same line,
      * should there be a semicolon between them?
@@ -117,7 +139,7 @@ struct message_line
     {
         messages = { { msg, 1 } };
         // Don't join long messages.
-        join = jn && strwidth(last_msg().pure_text()) < 40;
+        join = jn && last_msg().pure_width < 40;
     }
 
     // Constructor for restored messages.
@@ -202,7 +224,7 @@ struct message_line
         {
             if (len > 0) // not first msg
                 len += msg.needs_semicolon() ? 2 : 1; // " " vs "; "
-            len += strwidth(msg.pure_text_with_repeats());
+            len += msg.pure_width_with_repeats();
         }
         return len;
     }
@@ -844,6 +866,20 @@ public:
 // Circular buffer for keeping past messages.
 message_store buffer;
 
+size_t messages_memory_used()
+{
+    size_t bytes = sizeof(buffer);
+    const store_t &msgs = buffer.get_store();
+    for (int i = 0; i < msgs.size(); ++i)
+    {
+        const message_line &msg = msgs[i];
+        bytes += msg.messages.capacity() * sizeof(message_particle);
+        for (const message_particle &mp : msg.messages)
+            bytes += mp.text.capacity() + mp.pure.capacity();
+    }
+    return bytes;
+}
+
 #ifdef USE_TILE_WEB
 bool _more = false, _last_more = false;
 
@@ -108,6 +108,10 @@ void save_messages(writer& outf);
 void load_messages(reader& inf);
 void clear_message_store();
 
+// Rough heap footprint of the stored message history, for the wizmode
+// memory report.
+size_t messages_memory_used();
+
 // Have any messages been printed since the last clear?
 bool any_messages();
 
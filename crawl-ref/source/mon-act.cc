@@ -2556,8 +2556,9 @@ static void _clear_monster_flags()
     // monsters get their actions in the next round.
     // Also clear one-turn deep sleep flag.
     // XXX: MF_JUST_SLEPT only really works for player-cast hibernation.
-    for (auto &mons : menv_real)
-        mons.flags &= ~MF_JUST_SUMMONED & ~MF_JUST_SLEPT;
+    const int watermark = monster_slot_watermark();
+    for (int i = 0; i < watermark; ++i)
+        menv[i].flags &= ~MF_JUST_SUMMONED & ~MF_JUST_SLEPT;
 }
 
 /**
@@ -2583,12 +2584,17 @@ static void _update_monster_attitude(monster *mon)
  */
 void handle_monsters(bool with_noise)
 {
+    // This sweep visits every live slot anyway, so use it to re-tighten
+    // the live-slot watermark that bounds monster_iterator scans.
+    int highest_live = -1;
     for (monster_iterator mi; mi; ++mi)
     {
+        highest_live = mi->mindex();
         _pre_monster_move(**mi);
         if (!invalid_monster(*mi) && mi->alive() && mi->has_action_energy())
             monster_queue.emplace(*mi, mi->speed_increment);
     }
+    tighten_monster_slot_watermark(highest_live);
 
     int tries = 0; // infinite loop protection, shouldn't be ever needed
     while (!monster_queue.empty())
@@ -962,23 +962,40 @@ void set_nearest_monster_foe(monster* mon, bool near_player)
 
     while (true)
     {
-        for (int k = 1; k <= LOS_RADIUS; ++k)
+        // Gather the closest qualifying foes (by ring distance, with
+        // random tie-break, as the old per-ring cell scan did). Only an
+        // actor's cell can qualify, so sweeping the live monsters plus
+        // the player's cell is much cheaper than probing every cell
+        // within LOS_RADIUS of the center.
+        int best_dist = LOS_RADIUS + 1;
+        vector<coord_def> monster_pos;
+
+        auto consider_foe_at = [&](const coord_def &p)
         {
-            vector<coord_def> monster_pos;
-            for (int i = -k; i <= k; ++i)
-                for (int j = -k; j <= k; (abs(i) == k ? j++ : j += 2*k))
-                {
-                    const coord_def p = center + coord_def(i, j);
+            const int dist = grid_distance(p, center);
+            if (dist < 1 || dist > LOS_RADIUS || dist > best_dist)
+                return;
+
+            if (near_player && !you.see_cell(p))
+                return;
 
-                    if (near_player && !you.see_cell(p))
-                        continue;
+            if (!_mons_check_foe(mon, p, friendly, neutral, second_pass))
+                return;
 
-                    if (_mons_check_foe(mon, p, friendly, neutral, second_pass))
-                        monster_pos.push_back(p);
-                }
-            if (monster_pos.empty())
-                continue;
+            if (dist < best_dist)
+            {
+                best_dist = dist;
+                monster_pos.clear();
+            }
+            monster_pos.push_back(p);
+        };
+
+        for (monster_iterator mi; mi; ++mi)
+            consider_foe_at(mi->pos());
+        consider_foe_at(you.pos());
 
+        if (!monster_pos.empty())
+        {
             const coord_def mpos = monster_pos[random2(monster_pos.size())];
             if (mpos == you.pos())
                 mon->foe = MHITYOU;
@@ -1021,6 +1038,8 @@ void behaviour_event(monster* mon, mon_event_type event, const actor *src,
     if (mons_is_projectile(mon->type))
         return; // projectiles have no AI
 
+    invalidate_tension_cache();
+
     const beh_type old_behaviour = mon->behaviour;
 
     bool isSmart          = (mons_intel(*mon) >= I_HUMAN);
@@ -4052,22 +4052,24 @@ static mon_spell_slot _choose_spell_to_cast(monster &mons,
         // get here... even if the monster is on its last HP. That
         // way we don't have to worry about monsters infinitely casting
         // Healing on themselves (e.g. orc high priests).
-        int found_spell = 0;
-        mon_spell_slot chosen_slot = { SPELL_NO_SPELL, 0, MON_SPELL_NO_FLAGS };
-        for (const mon_spell_slot &slot : hspell_pass)
+        //
+        // Try the candidates in random order and take the first that
+        // justifies. This picks with the same distribution as the old
+        // scheme of justifying every slot (tracing a beam for each) and
+        // sampling uniformly among the successes, but stops tracing at
+        // the first usable spell.
+        monster_spells shuffled_pass = hspell_pass;
+        shuffle_array(shuffled_pass);
+        for (const mon_spell_slot &slot : shuffled_pass)
         {
             bolt targ_beam = orig_beem;
             if (_target_and_justify_spell(mons, targ_beam, slot.spell,
-                                          ignore_good_idea)
-                && one_chance_in(++found_spell))
+                                          ignore_good_idea))
             {
-                chosen_slot = slot;
                 beem = targ_beam;
+                return slot;
             }
         }
-
-        if (chosen_slot.spell != SPELL_NO_SPELL)
-            return chosen_slot;
     }
 
     // If nothing found by now, safe friendlies and good
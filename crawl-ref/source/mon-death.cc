@@ -1815,6 +1815,9 @@ item_def* monster_die(monster* mons, killer_type killer,
     if (invalid_monster(mons))
         return nullptr;
 
+    // Catches deaths that don't go through hurt(): dismissals, resets.
+    invalidate_tension_cache();
+
     const bool was_visible = you.can_see(*mons);
 
     // If a monster was banished to the Abyss and then killed there,
@@ -2841,6 +2844,12 @@ void monster_cleanup(monster* mons)
     unsigned int monster_killed = mons->mindex();
     mons->reset();
 
+    // One pass fixes up stale foe indices and releases this monster's
+    // summons. The foe half has to stay eager -- mindex slots can be
+    // reused as soon as something else is placed -- and with iteration
+    // bounded by the live-slot watermark, both halves are down to a
+    // couple of integer compares per live monster. A reverse
+    // summoner->summons index wouldn't pay for its bookkeeping here.
     for (monster_iterator mi; mi; ++mi)
     {
         if (mi->foe == monster_killed)
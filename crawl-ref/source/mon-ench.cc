@@ -181,6 +181,7 @@ bool monster::add_ench(const mon_enchant &ench)
     {
         align_avatars(true);
     }
+    invalidate_tension_cache();
     return true;
 }
 
@@ -409,6 +410,7 @@ bool monster::del_ench(enchant_type ench, bool quiet, bool effect)
     ench_cache.set(et, false);
     if (effect)
         remove_enchantment_effect(me, quiet);
+    invalidate_tension_cache();
     return true;
 }
 
@@ -2046,10 +2048,16 @@ void monster::apply_enchantments()
     FixedBitVector<NUM_ENCHANTMENTS> ec = ench_cache;
 
     // The ordering in enchant_type makes sure that "super-enchantments"
-    // like berserk time out before their parts.
-    for (int i = 0; i < NUM_ENCHANTMENTS; ++i)
-        if (ec[i] && has_ench(static_cast<enchant_type>(i)))
+    // like berserk time out before their parts. Walking set bits rather
+    // than the whole enum matters here: this runs for every monster
+    // action, and most monsters carry a handful of enchantments out of
+    // the hundred-odd defined.
+    for (unsigned int i = ec.first_set(); i < NUM_ENCHANTMENTS;
+         i = ec.next_set(i))
+    {
+        if (has_ench(static_cast<enchant_type>(i)))
             apply_enchantment(enchantments.find(static_cast<enchant_type>(i))->second);
+    }
 }
 
 // Used to adjust time durations in calc_duration() for monster speed.
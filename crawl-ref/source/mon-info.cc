@@ -25,6 +25,7 @@
 #include "itemprop.h"
 #include "libutil.h"
 #include "los.h"
+#include "losglobal.h"
 #include "message.h"
 #include "mon-book.h"
 #include "mon-death.h" // ELVEN_IS_ENERGIZED_KEY
@@ -166,8 +167,12 @@ static monster_info_flags ench_to_mb(const monster& mons, enchant_type ench)
 static bool _blocked_ray(const coord_def &where,
                          dungeon_feature_type* feat = nullptr)
 {
-    if (exists_ray(you.pos(), where, opc_solid_see)
-        || !exists_ray(you.pos(), where, opc_default))
+    // Answered from the cached global LOS fields: visibility there is
+    // defined by the same cellray tables exists_ray searches, and one
+    // field update at you.pos() covers every monster queried this
+    // redraw, instead of fresh ray searches per monster.
+    if (cell_see_cell(you.pos(), where, LOS_SOLID_SEE)
+        || !cell_see_cell(you.pos(), where, LOS_DEFAULT))
     {
         return false;
     }
@@ -1791,6 +1796,23 @@ bool monster_info::debuffable() const
 
 void get_monster_info(vector<monster_info>& mons)
 {
+    // The monster pane rebuilds and re-sorts this list on every redraw,
+    // and several redraws can land within a single player action. While
+    // game time stands still and no monster state change has bumped the
+    // tension cache epoch, nothing the list depends on can change, so
+    // hand back the previous snapshot.
+    static vector<monster_info> cached;
+    static int cached_epoch = -1;
+    static int cached_time = -1;
+
+    const bool cacheable = !crawl_state.game_is_arena();
+    if (cacheable && tension_cache_epoch() == cached_epoch
+        && you.elapsed_time == cached_time)
+    {
+        mons.insert(mons.end(), cached.begin(), cached.end());
+        return;
+    }
+
     vector<monster* > visible;
     if (crawl_state.game_is_arena())
     {
@@ -1809,6 +1831,13 @@ void get_monster_info(vector<monster_info>& mons)
         }
     }
     sort(mons.begin(), mons.end(), monster_info::less_than_wrapper);
+
+    if (cacheable)
+    {
+        cached = mons;
+        cached_epoch = tension_cache_epoch();
+        cached_time = you.elapsed_time;
+    }
 }
 
 monster_type monster_info::draco_or_demonspawn_subspecies() const
@@ -77,6 +77,197 @@ static void _mark_neighbours_target_unreachable(monster* mon)
     }
 }
 
+// The neighbour marking above only reaches monsters within a radius of 2
+// at the moment of failure. To also catch same-profile monsters elsewhere
+// that ask later in the same turn, remember every failed search (start,
+// target and movement restrictions) until the turn counter changes, and
+// let them skip the doomed flood fill entirely.
+struct failed_path_search
+{
+    int            turn;
+    coord_def      start;
+    coord_def      target;
+    mon_intel_type intel;
+    habitat_type   habitat;
+    bool           flies;
+    bool           amphibious;
+    bool           amph_lava;
+    bool           clings;
+};
+
+static vector<failed_path_search> _failed_searches;
+
+static void _record_failed_search(const monster* mon, const coord_def& target)
+{
+    // Drop results from earlier turns; terrain, clouds or doors may have
+    // changed since then.
+    if (!_failed_searches.empty() && _failed_searches[0].turn != you.num_turns)
+        _failed_searches.clear();
+
+    failed_path_search fs;
+    fs.turn       = you.num_turns;
+    fs.start      = mon->pos();
+    fs.target     = target;
+    fs.intel      = mons_intel(*mon);
+    fs.habitat    = mons_primary_habitat(*mon);
+    fs.flies      = mon->airborne();
+    fs.amphibious = (mons_habitat(*mon) == HT_AMPHIBIOUS);
+    fs.amph_lava  = (mons_habitat(*mon) == HT_AMPHIBIOUS_LAVA);
+    fs.clings     = mon->can_cling_to_walls();
+    _failed_searches.push_back(fs);
+}
+
+// Did a monster with the same (or fewer) movement options already fail to
+// reach this target from nearby this turn? The profile checks mirror
+// _mark_neighbours_target_unreachable().
+static bool _matches_failed_search(const monster* mon, const coord_def& target)
+{
+    for (const failed_path_search &fs : _failed_searches)
+    {
+        if (fs.turn != you.num_turns || fs.target != target)
+            continue;
+
+        if (mons_intel(*mon) > fs.intel)
+            continue;
+
+        if (mons_primary_habitat(*mon) != fs.habitat)
+            continue;
+
+        if (mon->can_cling_to_walls() != fs.clings)
+            continue;
+
+        if (!fs.flies && mon->airborne()
+            || !fs.amphibious && mons_habitat(*mon) == HT_AMPHIBIOUS
+            || !fs.amph_lava  && mons_habitat(*mon) == HT_AMPHIBIOUS_LAVA)
+        {
+            continue;
+        }
+
+        // Only trust the result if we're close to where the failed search
+        // started; from further away a path might still exist.
+        if (grid_distance(mon->pos(), fs.start) > LOS_RADIUS
+            || !cell_see_cell(mon->pos(), fs.start, LOS_NO_TRANS))
+        {
+            continue;
+        }
+
+        return true;
+    }
+    return false;
+}
+
+// Successful searches are worth sharing too: a shout or other noise
+// alerts whole packs to the same square, and each monster then ran its
+// own flood fill toward it. Remember the full cell-by-cell paths found
+// this turn; a monster standing on (or with a clear line to) a cell of
+// such a path can take over its tail instead of searching again. Every
+// reused cell is revalidated against the new monster's own movement
+// capabilities, so no habitat/flight profile matching is needed — a
+// monster that can't walk the recorded path simply falls through to a
+// full search of its own.
+struct shared_path_search
+{
+    int               turn;
+    coord_def         target;
+    vector<coord_def> path; // every step, search start to target
+};
+
+static vector<shared_path_search> _shared_paths;
+
+static void _record_shared_path(const coord_def& target,
+                                const vector<coord_def>& path)
+{
+    // Drop paths from earlier turns; terrain or doors may have changed.
+    if (!_shared_paths.empty() && _shared_paths[0].turn != you.num_turns)
+        _shared_paths.clear();
+
+    if (path.size() < 2 || _shared_paths.size() >= 10)
+        return;
+
+    shared_path_search sp;
+    sp.turn   = you.num_turns;
+    sp.target = target;
+    sp.path   = path;
+    _shared_paths.push_back(sp);
+}
+
+// Try to put mon on the tail of a path another monster found to the
+// same target this turn. On success, fills in mon's travel path (as
+// waypoints, like monster_pathfind::calc_waypoints()) and returns true.
+static bool _reuse_shared_path(monster* mon, const coord_def& target)
+{
+    for (const shared_path_search &sp : _shared_paths)
+    {
+        if (sp.turn != you.num_turns || sp.target != target)
+            continue;
+
+        // Find the latest path cell the monster can step straight onto.
+        int join = -1;
+        for (int i = (int)sp.path.size() - 2; i >= 0; --i)
+        {
+            if (sp.path[i] == mon->pos())
+            {
+                join = i;
+                break;
+            }
+            if (grid_distance(sp.path[i], mon->pos()) <= LOS_RADIUS
+                && mons_can_traverse(mon, sp.path[i])
+                && can_go_straight(mon, mon->pos(), sp.path[i]))
+            {
+                join = i;
+                break;
+            }
+        }
+        if (join == -1)
+            continue;
+
+        // The monster has to be able to walk the rest of the path
+        // itself. The final cell is exempt, matching the pathfinder,
+        // which never checks the target square for traversability.
+        bool walkable = true;
+        for (unsigned int i = join + 1; i < sp.path.size() - 1; ++i)
+        {
+            if (!mons_can_traverse(mon, sp.path[i]))
+            {
+                walkable = false;
+                break;
+            }
+        }
+        if (!walkable)
+            continue;
+
+        // Reduce the tail to waypoints, the same way calc_waypoints()
+        // does for a freshly found path.
+        vector<coord_def> waypoints;
+        coord_def wpos = sp.path[join];
+        for (unsigned int i = join + 1; i < sp.path.size(); ++i)
+        {
+            if (can_go_straight(mon, wpos, sp.path[i])
+                && mons_can_traverse(mon, sp.path[i]))
+            {
+                continue;
+            }
+            wpos = sp.path[i - 1];
+            waypoints.push_back(wpos);
+        }
+        if (wpos != sp.path.back())
+            waypoints.push_back(sp.path.back());
+
+        if (waypoints.empty())
+            continue;
+
+#ifdef DEBUG_PATHFIND
+        mprf("%s reuses a path found earlier this turn.",
+             mon->name(DESC_PLAIN).c_str());
+#endif
+        mon->travel_path = waypoints;
+        mon->target = mon->travel_path[0];
+        mon->travel_target = MTRAV_FOE;
+        return true;
+    }
+    return false;
+}
+
 static void _set_no_path_found(monster* mon)
 {
 #ifdef DEBUG_PATHFIND
@@ -220,16 +411,35 @@ bool try_pathfind(monster* mon)
          mon->name(DESC_PLAIN).c_str(), mon->pos().x, mon->pos().y,
          targpos.x, targpos.y, range);
 #endif
+    // A monster with the same movement restrictions may already have run
+    // this very search this turn and come up empty.
+    if (_matches_failed_search(mon, targpos))
+    {
+#ifdef DEBUG_PATHFIND
+        mprf("Another monster already failed this search. (%s)",
+             mon->name(DESC_PLAIN).c_str());
+#endif
+        mon->travel_target = MTRAV_UNREACHABLE;
+        return false;
+    }
+
+    // Perhaps a monster alerted to the same spot found a path this turn
+    // that passes right by us.
+    if (_reuse_shared_path(mon, targpos))
+        return true;
+
     monster_pathfind mp;
     if (range > 0)
         mp.set_range(range);
 
     if (mp.init_pathfind(mon, targpos))
     {
+        const vector<coord_def> path = mp.backtrack();
         mon->travel_path = mp.calc_waypoints();
         if (!mon->travel_path.empty())
         {
             // Okay then, we found a path. Let's use it!
+            _record_shared_path(targpos, path);
             mon->target = mon->travel_path[0];
             mon->travel_target = MTRAV_FOE;
             return true;
@@ -237,6 +447,7 @@ bool try_pathfind(monster* mon)
     }
 
     // We didn't find a path.
+    _record_failed_search(mon, targpos);
     _set_no_path_found(mon);
     return false;
 }
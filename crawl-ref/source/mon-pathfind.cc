@@ -67,7 +67,7 @@ int mons_tracking_range(const monster* mon)
 //#define DEBUG_PATHFIND
 monster_pathfind::monster_pathfind()
     : mons(nullptr), start(), target(), pos(), allow_diagonals(true),
-      traverse_unmapped(false), range(0), min_length(0), max_length(0),
+      traverse_unmapped(false), range(0), min_length(0),
       dist(), prev(), hash()
 {
 }
@@ -139,7 +139,8 @@ bool monster_pathfind::start_pathfind(bool msg)
     //       surrounded by shallow water or floor, or if a foe is hiding in
     //       a wall.
 
-    max_length = min_length = grid_distance(pos, target);
+    min_length = grid_distance(pos, target);
+    hash.clear();
     for (int i = 0; i < GXM; i++)
         for (int j = 0; j < GYM; j++)
             dist[i][j] = INFINITE_DISTANCE;
@@ -247,8 +248,6 @@ bool monster_pathfind::calc_path_to_neighbours()
                      npos.x, npos.y, total);
 #endif
                 add_new_pos(npos, total);
-                if (total > max_length)
-                    max_length = total;
             }
             else
             {
@@ -284,34 +283,36 @@ bool monster_pathfind::calc_path_to_neighbours()
     return false;
 }
 
-// Starting at known min_length (minimum total estimated path distance), check
-// the hash for existing vectors, then pick the last entry of the first vector
-// that matches. Update min_length, if necessary.
+// The hash is ordered by total estimated path distance, so the first
+// non-empty bucket holds the best candidates; pick its last entry.
+// Buckets emptied by update_pos() are dropped as we pass them.
+// Update min_length, if necessary.
 bool monster_pathfind::get_best_position()
 {
-    for (int i = min_length; i <= max_length; i++)
+    while (!hash.empty())
     {
-        if (!hash[i].empty())
+        auto it = hash.begin();
+        vector<coord_def> &vec = it->second;
+        if (vec.empty())
         {
-            if (i > min_length)
-                min_length = i;
+            hash.erase(it);
+            continue;
+        }
 
-            vector<coord_def> &vec = hash[i];
-            // Pick the last position pushed into the vector as it's most
-            // likely to be close to the target.
-            pos = vec[vec.size()-1];
-            vec.pop_back();
+        if (it->first > min_length)
+            min_length = it->first;
 
-#ifdef DEBUG_PATHFIND
-            mprf("Returning (%d, %d) as best pos with total dist %d.",
-                 pos.x, pos.y, min_length);
-#endif
+        // Pick the last position pushed into the vector as it's most
+        // likely to be close to the target.
+        pos = vec[vec.size()-1];
+        vec.pop_back();
 
-            return true;
-        }
 #ifdef DEBUG_PATHFIND
-        mprf("No positions for path length %d.", i);
+        mprf("Returning (%d, %d) as best pos with total dist %d.",
+             pos.x, pos.y, min_length);
 #endif
+
+        return true;
     }
 
     // Nothing found? Then there's no path! :(
@@ -56,16 +56,18 @@ protected:
     // Maximum range to search between start and target. None, if zero.
     int range;
 
-    // Currently shortest and longest possible total length of the path.
+    // Currently shortest possible total length of the path.
     int min_length;
-    int max_length;
 
     // The array of distances from start to any already tried point.
     int dist[GXM][GYM];
     // An array to store where we came from on a given shortest path.
     int prev[GXM][GYM];
 
-    FixedVector<vector<coord_def>, GXM * GYM> hash;
+    // Open positions, bucketed by total estimated path length. Only
+    // lengths actually reached get a bucket, so constructing a pathfind
+    // on the stack stays cheap.
+    map<int, vector<coord_def>> hash;
 };
 
 #endif
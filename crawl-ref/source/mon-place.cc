@@ -125,6 +125,17 @@ bool monster_habitable_grid(const monster* mon,
     return monster_habitable_grid(mt, actual_grid, DNGN_UNSEEN, mon->airborne());
 }
 
+static bool _monster_habitable_grid_uncached(monster_type mt,
+                                             dungeon_feature_type actual_grid,
+                                             dungeon_feature_type wanted_grid,
+                                             bool flies);
+
+// Habitability depends only on (class, feature, flight), all immutable
+// class data, so memoize it: placement floods and monster pathfinding
+// query it for every cell they visit, and this makes each query a
+// single table read. 0 = not yet computed, else 1 + the answer.
+static uint8_t _habitable_cache[2][NUM_MONSTERS][NUM_FEATURES];
+
 /**
  * Can monsters of this class survive on actual_grid?
  *
@@ -140,6 +151,28 @@ bool monster_habitable_grid(monster_type mt,
                             dungeon_feature_type actual_grid,
                             dungeon_feature_type wanted_grid,
                             bool flies)
+{
+    if (wanted_grid == DNGN_UNSEEN
+        && mt >= 0 && mt < NUM_MONSTERS
+        && actual_grid >= 0 && actual_grid < NUM_FEATURES)
+    {
+        uint8_t &entry = _habitable_cache[flies][mt][actual_grid];
+        if (!entry)
+        {
+            entry = 1 + _monster_habitable_grid_uncached(mt, actual_grid,
+                                                         wanted_grid, flies);
+        }
+        return entry == 2;
+    }
+
+    return _monster_habitable_grid_uncached(mt, actual_grid, wanted_grid,
+                                            flies);
+}
+
+static bool _monster_habitable_grid_uncached(monster_type mt,
+                                             dungeon_feature_type actual_grid,
+                                             dungeon_feature_type wanted_grid,
+                                             bool flies)
 {
     // No monster may be placed in walls etc.
     if (!mons_class_can_pass(mt, actual_grid))
@@ -1172,16 +1205,85 @@ monster* place_monster(mgen_data mg, bool force_pos, bool dont_place)
     return mon;
 }
 
+// Monster slots released since the last full scan, by mindex. Entries
+// are revalidated when popped — a slot recycled behind our back is just
+// dropped — so the list is allowed to go stale across level changes and
+// direct writes into menv; when it runs dry, get_free_monster() falls
+// back to the old full scan and restocks it.
+static vector<int> _free_monster_slots;
+
+void notify_monster_slot_freed(int mindex)
+{
+    if (mindex >= 0 && mindex < MAX_MONSTERS)
+        _free_monster_slots.push_back(mindex);
+}
+
+// Exclusive upper bound on the menv slots that may hold a live monster,
+// so monster_iterator doesn't scan all MAX_MONSTERS slots when the
+// level holds far fewer. Advisory in the same spirit as the free-slot
+// list above: it may overestimate (costing only scan length), but never
+// underestimates — it is raised whenever a slot is handed out or a
+// level's monsters are loaded, and tightened again by the full sweep at
+// the start of handle_monsters().
+static int _monster_slot_watermark = MAX_MONSTERS;
+
+int monster_slot_watermark()
+{
+    return _monster_slot_watermark;
+}
+
+void raise_monster_slot_watermark(int mindex)
+{
+    if (mindex >= _monster_slot_watermark)
+        _monster_slot_watermark = mindex + 1;
+}
+
+void tighten_monster_slot_watermark(int highest_live)
+{
+    _monster_slot_watermark = highest_live + 1;
+}
+
 monster* get_free_monster()
 {
+    while (!_free_monster_slots.empty())
+    {
+        const int slot = _free_monster_slots.back();
+        _free_monster_slots.pop_back();
+        monster &mons = menv[slot];
+        if (mons.type != MONS_NO_MONSTER)
+            continue;
+        mons.reset();
+        // reset() renotified the slot we're about to hand out; drop it.
+        if (!_free_monster_slots.empty()
+            && _free_monster_slots.back() == slot)
+        {
+            _free_monster_slots.pop_back();
+        }
+        raise_monster_slot_watermark(slot);
+        return &mons;
+    }
+
+    monster *found = nullptr;
     for (auto &mons : menv_real)
         if (mons.type == MONS_NO_MONSTER)
         {
-            mons.reset();
-            return &mons;
+            if (!found)
+                found = &mons;
+            else
+                _free_monster_slots.push_back(mons.mindex());
         }
 
-    return nullptr;
+    if (found)
+    {
+        found->reset();
+        if (!_free_monster_slots.empty()
+            && _free_monster_slots.back() == found->mindex())
+        {
+            _free_monster_slots.pop_back();
+        }
+        raise_monster_slot_watermark(found->mindex());
+    }
+    return found;
 }
 
 void mons_add_blame(monster* mon, const string &blame_string)
@@ -1242,25 +1344,33 @@ static monster* _place_monster_aux(const mgen_data &mg, const monster *leader,
     }
     else
     {
-        int i;
-        // We'll try 1000 times for a good spot.
-        for (i = 0; i < 1000; ++i)
-        {
-            fpos = mg.pos + coord_def(random_range(-3, 3),
-                                      random_range(-3, 3));
-
-            // Place members within LOS_SOLID of their leader.
-            // TODO nfm - allow placing around corners but not across walls.
-            if ((leader == 0 || cell_see_cell(fpos, leader->pos(), LOS_SOLID))
-                && _valid_monster_generation_location(mg, fpos))
+        // Enumerate the candidate box once and choose uniformly among
+        // the valid spots. The old scheme made up to 1000 random probes
+        // into the same 7x7 box, spending most of its time re-testing
+        // cells it had already rejected; the selection distribution is
+        // the same, minus the chance of spurious failure when valid
+        // spots were scarce.
+        vector<coord_def> candidates;
+        for (int dx = -3; dx <= 3; ++dx)
+            for (int dy = -3; dy <= 3; ++dy)
             {
-                break;
+                const coord_def c = mg.pos + coord_def(dx, dy);
+
+                // Place members within LOS_SOLID of their leader.
+                // TODO nfm - allow placing around corners but not across
+                // walls.
+                if ((leader == 0
+                     || cell_see_cell(c, leader->pos(), LOS_SOLID))
+                    && _valid_monster_generation_location(mg, c))
+                {
+                    candidates.push_back(c);
+                }
             }
-        }
 
-        // Did we really try 1000 times?
-        if (i == 1000)
+        if (candidates.empty())
             return 0;
+
+        fpos = candidates[random2(candidates.size())];
     }
 
     ASSERT(!monster_at(fpos));
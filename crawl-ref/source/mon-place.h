@@ -112,6 +112,10 @@ void set_vault_mon_list(const vector<mons_spec> &list);
 void setup_vault_mon_list();
 
 monster* get_free_monster();
+void notify_monster_slot_freed(int mindex);
+int monster_slot_watermark();
+void raise_monster_slot_watermark(int mindex);
+void tighten_monster_slot_watermark(int highest_live);
 
 bool can_place_on_trap(monster_type mon_type, trap_type trap);
 void mons_add_blame(monster* mon, const string &blame_string);
@@ -11,6 +11,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <unordered_set>
 
 #include "areas.h"
 #include "branch.h"
@@ -27,6 +28,24 @@
 #include "stringutil.h"
 #include "view.h"
 
+// The speech database is immutable once loaded, and nearly every probe
+// below misses: a speaking monster tries dozens of prefix permutations,
+// and most monsters have nothing in the database at all. Remember the
+// misses for the session, so the common silent case costs one hash
+// probe per key instead of a database query.
+static unordered_set<string> _speech_misses;
+
+static string _speak_lookup(const string &dbkey)
+{
+    if (_speech_misses.count(dbkey))
+        return "";
+
+    const string msg = getSpeakString(dbkey);
+    if (msg.empty())
+        _speech_misses.insert(dbkey);
+    return msg;
+}
+
 // Try the exact key lookup along with the entire prefix list.
 // If that fails, start ignoring hostile/religion/branch/silence, in that order,
 // first skipping hostile, then hostile *and* religion, then hostile, religion
@@ -86,7 +105,7 @@ static string __try_exact_string(const vector<string> &prefixes,
         prefix += prefixes[i];
         prefix += " ";
     }
-    msg = getSpeakString(prefix + key);
+    msg = _speak_lookup(prefix + key);
 
     if (msg.empty())
     {
@@ -231,7 +250,7 @@ static string __get_speak_string(const vector<string> &prefixes,
                     prefix += prefixes[j] + " ";
                     prefix += prefixes[k] + " ";
 
-                    msg = getSpeakString("default " + prefix + key);
+                    msg = _speak_lookup("default " + prefix + key);
 
                     if (!msg.empty())
                         return msg;
@@ -247,7 +266,7 @@ static string __get_speak_string(const vector<string> &prefixes,
                 prefix  = prefixes[i] + " ";
                 prefix += prefixes[j] + " ";
 
-                msg = getSpeakString("default " + prefix + key);
+                msg = _speak_lookup("default " + prefix + key);
 
                 if (!msg.empty())
                     return msg;
@@ -261,7 +280,7 @@ static string __get_speak_string(const vector<string> &prefixes,
         {
             prefix  = prefixes[i] + " ";
 
-            msg = getSpeakString("default " + prefix + key);
+            msg = _speak_lookup("default " + prefix + key);
 
             if (!msg.empty())
                 return msg;
@@ -269,7 +288,7 @@ static string __get_speak_string(const vector<string> &prefixes,
     }
 
     // No prefixes
-    msg = getSpeakString("default " + key);
+    msg = _speak_lookup("default " + key);
 
     return msg;
 }
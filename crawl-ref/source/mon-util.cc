@@ -215,9 +215,20 @@ void init_mon_name_cache()
     }
 }
 
-static const char *_mon_entry_name(size_t idx)
+// Lowercased copies of mondata[].name, built once. The substring scan
+// below used to lowercase -- and heap-allocate -- every entry's name on
+// every query, and vault parsing does thousands of these while building
+// the des cache.
+static vector<string> Mon_Name_LC;
+
+static void _init_mon_name_lc()
 {
-    return mondata[idx].name;
+    if (!Mon_Name_LC.empty())
+        return;
+
+    Mon_Name_LC.reserve(ARRAYSZ(mondata));
+    for (const monsterentry &me : mondata)
+        Mon_Name_LC.push_back(lowercase_string(me.name));
 }
 
 monster_type get_monster_by_name(string name, bool substring)
@@ -227,17 +238,41 @@ monster_type get_monster_by_name(string name, bool substring)
 
     lowercase(name);
 
+    // Exact matches win outright even in substring mode, and the name
+    // cache answers them without a scan.
+    if (monster_type *mc = map_find(Mon_Name_Cache, name))
+        return *mc;
     if (!substring)
-    {
-        if (monster_type *mc = map_find(Mon_Name_Cache, name))
-            return *mc;
         return MONS_PROGRAM_BUG;
-    }
 
-    size_t idx = find_earliest_match(name, (size_t) 0, ARRAYSZ(mondata),
-                                     always_true<size_t>, _mon_entry_name);
-    return idx == ARRAYSZ(mondata) ? MONS_PROGRAM_BUG
-                                   : (monster_type) mondata[idx].mc;
+    _init_mon_name_lc();
+
+    // Same selection rule as find_earliest_match, over the precomputed
+    // lowercase names: prefer the earliest match position, breaking ties
+    // at position 0 in favour of shorter names.
+    const size_t speclen = name.length();
+    size_t best = ARRAYSZ(mondata);
+    size_t bestpos = string::npos;
+    size_t bestlen = string::npos;
+    for (size_t i = 0; i < ARRAYSZ(mondata); ++i)
+    {
+        const string &entry = Mon_Name_LC[i];
+        const size_t pos = entry.find(name);
+        const size_t len = entry.length();
+
+        if (pos < bestpos || pos == 0 && len < bestlen)
+        {
+            if (pos == 0 && len == speclen)
+                return monster_type(mondata[i].mc);
+
+            bestpos = pos;
+            if (pos == 0)
+                bestlen = len;
+            best = i;
+        }
+    }
+    return best == ARRAYSZ(mondata) ? MONS_PROGRAM_BUG
+                                    : (monster_type) mondata[best].mc;
 }
 
 void init_monsters()
@@ -362,10 +397,44 @@ resists_t get_mons_class_resists(monster_type mc)
     return _apply_holiness_resists(resists, mons_class_holiness(mc));
 }
 
+// Memo for get_mons_resists(). The full derivation walks the attack
+// flavour tables via holiness(), which makes each res_fire()-style
+// query surprisingly dear when an area spell hits a screenful of
+// monsters. Apart from ghost demons and mutant beasts - which read
+// per-instance state and skip the memo - everything the derivation
+// looks at is covered by the key fields below, so a slot entry can
+// never go stale: any change to the inputs changes the key.
+struct mons_resist_memo
+{
+    bool valid;
+    monster_type type;
+    monster_type base;
+    monster_flags_t flags;
+    god_type god;
+    resists_t resists;
+};
+static mons_resist_memo _mons_resist_memo[MAX_MONSTERS];
+
 resists_t get_mons_resists(const monster& m)
 {
     const monster& mon = get_tentacle_head(m);
 
+    mons_resist_memo *memo = nullptr;
+    const int slot = mon.mindex();
+    if (slot >= 0 && slot < MAX_MONSTERS && &menv[slot] == &mon
+        && !mons_is_ghost_demon(mon.type)
+        && !mon.props.exists(MUTANT_BEAST_FACETS))
+    {
+        memo = &_mons_resist_memo[slot];
+        if (memo->valid && memo->type == mon.type
+            && memo->base == mon.base_monster
+            && memo->flags == mon.flags
+            && memo->god == mon.god)
+        {
+            return memo->resists;
+        }
+    }
+
     resists_t resists = get_mons_class_resists(mon.type);
 
     if (mons_is_ghost_demon(mon.type))
@@ -388,7 +457,19 @@ resists_t get_mons_resists(const monster& m)
 
     // This is set from here in case they're undead due to the
     // MF_FAKE_UNDEAD flag. See the comment in get_mons_class_resists.
-    return _apply_holiness_resists(resists, mon.holiness());
+    resists = _apply_holiness_resists(resists, mon.holiness());
+
+    if (memo)
+    {
+        memo->valid = true;
+        memo->type = mon.type;
+        memo->base = mon.base_monster;
+        memo->flags = mon.flags;
+        memo->god = mon.god;
+        memo->resists = resists;
+    }
+
+    return resists;
 }
 
 int get_mons_resist(const monster& mon, mon_resist_flags res)
@@ -2123,7 +2204,7 @@ bool mons_class_sees_invis(monster_type type, monster_type base)
  * @param mc        The type of monster in question.
  * @return          The average hp for that monster; rounds down.
  */
-int mons_avg_hp(monster_type mc)
+static int _mons_avg_hp(monster_type mc)
 {
     const monsterentry* me = get_monster_data(mc);
 
@@ -2143,6 +2224,20 @@ int mons_avg_hp(monster_type mc)
     return me->avg_hp_10x / 10;
 }
 
+int mons_avg_hp(monster_type mc)
+{
+    // A pure function of the monster data tables, but the monster list
+    // comparator asks per comparison on every pane redraw; memoize it.
+    static FixedVector<short, NUM_MONSTERS> memo(-1);
+
+    if (mc < 0 || mc >= NUM_MONSTERS)
+        return _mons_avg_hp(mc);
+
+    if (memo[mc] < 0)
+        memo[mc] = _mons_avg_hp(mc);
+    return memo[mc];
+}
+
 /**
  * What's the maximum hp for a given type of monster?
  *
@@ -3198,18 +3293,31 @@ bool mons_aligned(const actor *m1, const actor *m2)
     if (!m1 || !m2)
         return true;
 
-    if (mons_is_projectile(m1->type) || mons_is_projectile(m2->type))
-        return true; // they won't directly attack each-other, anyway
+    if (mons_atts_aligned(m1->temp_attitude(), m2->temp_attitude()))
+        return true;
 
-    return mons_atts_aligned(m1->temp_attitude(), m2->temp_attitude());
+    // Projectiles won't directly attack each other, anyway. Checked
+    // after attitude: it needs two monster-data lookups, and in the
+    // ally-heavy games where this is hot, most pairs align outright.
+    return mons_is_projectile(m1->type) || mons_is_projectile(m2->type);
 }
 
 bool mons_atts_aligned(mon_attitude_type fr1, mon_attitude_type fr2)
 {
-    if (mons_att_wont_attack(fr1) && mons_att_wont_attack(fr2))
-        return true;
-
-    return fr1 == fr2;
+    // Called for every monster a beam tracer or foe scan considers, so
+    // the identical-or-both-peaceful rule is collapsed into one table
+    // load. Both-peaceful means mons_att_wont_attack() on each side.
+    COMPILE_CHECK(ATT_FRIENDLY == 4);
+    static const bool aligned[ATT_FRIENDLY + 1][ATT_FRIENDLY + 1] =
+    {
+        //                hostile neutral strict  good   friendly
+        /* hostile  */  { true,   false,  false,  false, false },
+        /* neutral  */  { false,  true,   false,  false, false },
+        /* strict   */  { false,  false,  true,   true,  true  },
+        /* good     */  { false,  false,  true,   true,  true  },
+        /* friendly */  { false,  false,  true,   true,  true  },
+    };
+    return aligned[fr1][fr2];
 }
 
 bool mons_class_wields_two_weapons(monster_type mc)
@@ -159,6 +159,13 @@ void monster::reset()
     // Just for completeness.
     speed           = 0;
     colour         = COLOUR_INHERIT;
+
+    // If this is a real menv slot, it can be handed out again without
+    // scanning for it. Stack-allocated monsters land outside the range
+    // and are skipped.
+    const int slot = int(this - menv.buffer());
+    if (slot >= 0 && slot < MAX_MONSTERS)
+        notify_monster_slot_freed(slot);
 }
 
 void monster::init_with(const monster& mon)
@@ -3537,6 +3544,7 @@ bool monster::heal(int amount)
         return false;
 
     hit_points += amount;
+    invalidate_tension_cache();
 
     bool success = true;
 
@@ -4442,6 +4450,8 @@ int monster::hurt(const actor *agent, int amount, beam_type flavour,
         return 0;
     }
 
+    invalidate_tension_cache();
+
     if (alive())
     {
         if (amount != INSTANT_DEATH
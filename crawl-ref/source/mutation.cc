@@ -252,7 +252,7 @@ bool is_body_facet(mutation_type mut)
                   { return facet.mut == mut; });
 }
 
-mutation_activity_type mutation_activity_level(mutation_type mut)
+static mutation_activity_type _mutation_activity_level(mutation_type mut)
 {
     // First make sure the player's form permits the mutation.
     if (!form_keeps_mutations())
@@ -330,6 +330,48 @@ mutation_activity_type mutation_activity_level(mutation_type mut)
     return MUTACT_FULL;
 }
 
+// Activity levels for all mutations, flattened so that the hot-path
+// queries through player_mutation_level() are plain array reads. Form,
+// god, species and Pakellas penance are cheap to compare, so they're
+// re-checked on every query; the one remaining input — the player's own
+// mutation levels, which matter for scale mutations in statue form —
+// is covered by invalidate_mutation_cache() calls from the code that
+// writes you.mutation[].
+static FixedVector<mutation_activity_type, NUM_MUTATIONS> _activity_cache;
+static bool                _activity_cache_valid = false;
+static transformation_type _activity_cache_form;
+static god_type            _activity_cache_god;
+static species_type        _activity_cache_species;
+static bool                _activity_cache_pak_penance;
+
+void invalidate_mutation_cache()
+{
+    _activity_cache_valid = false;
+}
+
+mutation_activity_type mutation_activity_level(mutation_type mut)
+{
+    const bool pak_penance = player_under_penance(GOD_PAKELLAS);
+    if (!_activity_cache_valid
+        || _activity_cache_form != you.form
+        || _activity_cache_god != you.religion
+        || _activity_cache_species != you.species
+        || _activity_cache_pak_penance != pak_penance)
+    {
+        for (int i = 0; i < NUM_MUTATIONS; ++i)
+        {
+            _activity_cache[i] =
+                _mutation_activity_level(static_cast<mutation_type>(i));
+        }
+        _activity_cache_form        = you.form;
+        _activity_cache_god         = you.religion;
+        _activity_cache_species     = you.species;
+        _activity_cache_pak_penance = pak_penance;
+        _activity_cache_valid       = true;
+    }
+    return _activity_cache[mut];
+}
+
 // Counts of various statuses/types of mutations from the current/most
 // recent call to describe_mutations. TODO: eliminate
 static int _num_full_suppressed = 0;
@@ -1355,6 +1397,7 @@ bool mutate(mutation_type which_mutation, const string &reason, bool failMsg,
                     // no need to redraw any stats or print any messages.
                     found = true;
                     you.mutation[mutat]--;
+                    invalidate_mutation_cache();
                     break;
                 }
         }
@@ -1385,6 +1428,7 @@ bool mutate(mutation_type which_mutation, const string &reason, bool failMsg,
     while (count-- > 0)
     {
         you.mutation[mutat]++;
+        invalidate_mutation_cache();
 
         // More than three messages, need to give them by hand.
         switch (mutat)
@@ -1576,6 +1620,7 @@ static bool _delete_single_mutation_level(mutation_type mutat,
     bool lose_msg = true;
 
     you.mutation[mutat]--;
+    invalidate_mutation_cache();
 
     switch (mutat)
     {
@@ -43,6 +43,7 @@ bool mutate(mutation_type which_mutation, const string &reason,
 void display_mutations();
 int mut_check_conflict(mutation_type mut, bool innate_only = false);
 mutation_activity_type mutation_activity_level(mutation_type mut);
+void invalidate_mutation_cache();
 string describe_mutations(bool center_title);
 
 bool delete_mutation(mutation_type which_mutation, const string &reason,
@@ -119,9 +119,15 @@ public:
     // Propagate noise from the noise sources registered.
     void propagate_noise();
 
-    // Clear all noise from the noise grid.
+    // Clear all noise from the noise grid. Only cells actually written
+    // since the last reset are cleared, so this is O(noise footprint),
+    // not O(map).
     void reset();
 
+    // Move the registered (but not yet propagated) noises into dest and
+    // reset the grid.
+    void take_noises(vector<noise_t> &dest);
+
     bool dirty() const { return !noises.empty(); }
 
 #ifdef DEBUG_NOISE_PROPAGATION
@@ -148,6 +154,8 @@ private:
 private:
     FixedArray<noise_cell, GXM, GYM> cells;
     vector<noise_t> noises;
+    // Cells written into since the last reset(); may contain duplicates.
+    vector<coord_def> dirty_cells;
     int affected_actor_count;
 };
 
@@ -8,6 +8,7 @@
 #include "notes.h"
 
 #include <iomanip>
+#include <set>
 #include <sstream>
 #include <vector>
 
@@ -28,6 +29,20 @@
 
 vector<Note> note_list;
 
+// Indexes over note_list for the duplicate checks in _is_noteworthy(),
+// so taking a note doesn't rescan every note in a long game. Maintained
+// by _index_note() whenever a note is added.
+static set<pair<int, int>> _seen_piety_ranks; // (god, rank)
+static vector<pair<int, int>> _recent_hp_notes; // (turn, hp)
+
+static void _index_note(const Note& note)
+{
+    if (note.type == NOTE_PIETY_RANK)
+        _seen_piety_ranks.insert(make_pair(note.first, note.second));
+    else if (note.type == NOTE_HP_CHANGE)
+        _recent_hp_notes.emplace_back(note.turn, note.first);
+}
+
 static bool _is_highest_skill(int skill)
 {
     for (int i = 0; i < NUM_SKILLS; ++i)
@@ -142,36 +157,25 @@ static bool _is_noteworthy(const Note& note)
     if (note.type == NOTE_DUNGEON_LEVEL_CHANGE)
         return _is_noteworthy_dlevel(note.place);
 
-    for (const Note &oldnote : note_list)
-    {
-        if (oldnote.type != note.type)
-            continue;
+    if (note.type == NOTE_PIETY_RANK)
+        return !_seen_piety_ranks.count(make_pair(note.first, note.second));
 
-        const Note& rnote(oldnote);
-        switch (note.type)
+    if (note.type == NOTE_HP_CHANGE)
+    {
+        // Not if we have a recent warning
+        // unless we've lost half our HP since then.
+        while (!_recent_hp_notes.empty()
+               && note.turn - _recent_hp_notes.front().first >= 5)
         {
-        case NOTE_PIETY_RANK:
-            if (rnote.first == note.first && rnote.second == note.second)
-                return false;
-            break;
-
-        case NOTE_HP_CHANGE:
-            // Not if we have a recent warning
-            // unless we've lost half our HP since then.
-            if (note.turn - rnote.turn < 5
-                && note.first * 2 >= rnote.first)
-            {
-                return false;
-            }
-            break;
-
-        default:
-            mpr("Buggy note passed: unknown note type");
-            // Return now, rather than give a "Buggy note passed" message
-            // for each note of the matching type in the note list.
-            return true;
+            _recent_hp_notes.erase(_recent_hp_notes.begin());
         }
+        for (const auto &entry : _recent_hp_notes)
+            if (note.first * 2 >= entry.second)
+                return false;
+        return true;
     }
+
+    mpr("Buggy note passed: unknown note type");
     return true;
 }
 
@@ -470,6 +474,7 @@ void take_note(const Note& note, bool force)
     if (notes_active && (force || _is_noteworthy(note)))
     {
         note_list.push_back(note);
+        _index_note(note);
         note.check_milestone();
     }
 }
@@ -487,8 +492,20 @@ void save_notes(writer& outf)
         note.save(outf);
 }
 
+void clear_notes()
+{
+    note_list.clear();
+    _seen_piety_ranks.clear();
+    _recent_hp_notes.clear();
+}
+
 void load_notes(reader& inf)
 {
+    // A stale index from a previous game in this session would suppress
+    // duplicate-checked notes with keys from the wrong game.
+    _seen_piety_ranks.clear();
+    _recent_hp_notes.clear();
+
     if (unmarshallInt(inf) != NOTES_VERSION_NUMBER)
         return;
 
@@ -498,6 +515,7 @@ void load_notes(reader& inf)
         Note new_note;
         new_note.load(inf);
         note_list.push_back(new_note);
+        _index_note(new_note);
     }
 }
 
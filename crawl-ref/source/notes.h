@@ -88,6 +88,7 @@ extern vector<Note> note_list;
 void activate_notes(bool active);
 bool notes_are_active();
 void take_note(const Note& note, bool force = false);
+void clear_notes();
 void save_notes(writer&);
 void load_notes(reader&);
 void make_user_note();
@@ -532,6 +532,9 @@ public:
     string      tile_display_mode;
     bool        tile_level_map_hide_messages;
     bool        tile_level_map_hide_sidebar;
+    // Save and exit after this many seconds without input at the main
+    // prompt, freeing the process's memory; 0 disables.
+    int         tile_web_idle_save_time;
 #endif
 #endif // USE_TILE
 
@@ -21,6 +21,7 @@
 #include "english.h"
 #include "env.h"
 #include "files.h"
+#include "format.h"
 #include "godabil.h"
 #include "godpassive.h"
 #include "initfile.h"
@@ -1023,6 +1024,34 @@ static void _get_status_lights(vector<status_light>& out)
             _add_status_light_to_out(status, out);
 }
 
+// The lights drawn by the last call, so that an unchanged set can skip
+// the redraw entirely: redraw_status_lights is set nearly every turn
+// (poison, duration ticks), but the derived lights rarely change while
+// resting. A y of -1 marks the cache invalid (e.g. after a full redraw).
+static vector<status_light> _last_lights_drawn;
+static int _last_lights_y = -1;
+
+static bool _lights_changed(const vector<status_light> &lights, int y)
+{
+    if (y == _last_lights_y && lights.size() == _last_lights_drawn.size())
+    {
+        size_t i = 0;
+        for (; i < lights.size(); ++i)
+        {
+            if (lights[i].colour != _last_lights_drawn[i].colour
+                || lights[i].text != _last_lights_drawn[i].text)
+            {
+                break;
+            }
+        }
+        if (i == lights.size())
+            return false;
+    }
+    _last_lights_drawn = lights;
+    _last_lights_y = y;
+    return true;
+}
+
 static void _print_status_lights(int y)
 {
     vector<status_light> lights;
@@ -1032,6 +1061,9 @@ static void _print_status_lights(int y)
         return;
     last_number_of_lights = lights.size();
 
+    if (!_lights_changed(lights, y))
+        return;
+
     size_t line_cur = y;
     const size_t line_end = crawl_view.hudsz.y+1;
 
@@ -1049,29 +1081,40 @@ static void _print_status_lights(int y)
     {
 #endif
     size_t i_light = 0;
-    while (true)
-    {
-        const int end_x = (wherex() - crawl_view.hudp.x)
-                + (i_light < lights.size() ? strwidth(lights[i_light].text)
-                                           : 10000);
-
-        if (end_x <= crawl_view.hudsz.x)
+    while (line_cur < line_end)
+    {
+        // Assemble the whole line before printing it, so each line goes
+        // out as a few colour runs instead of a write per light.
+        formatted_string line;
+        int cur_x = 0;
+        const int width = crawl_view.hudsz.x;
+        while (i_light < lights.size())
         {
-            textcolour(lights[i_light].colour);
-            CPRINTF("%s", lights[i_light].text.c_str());
-            if (end_x < crawl_view.hudsz.x)
-                CPRINTF(" ");
+            const int light_width = strwidth(lights[i_light].text);
+            if (cur_x + light_width > width)
+                break;
+            line.textcolour(lights[i_light].colour);
+            line.cprintf(lights[i_light].text);
+            cur_x += light_width;
+            if (cur_x < width)
+            {
+                line.cprintf(" ");
+                cur_x++;
+            }
             ++i_light;
         }
-        else
-        {
-            clear_to_end_of_line();
-            ++line_cur;
-            // Careful not to trip the )#(*$ CGOTOXY ASSERT
-            if (line_cur == line_end)
-                break;
+
+        if (line_cur > (size_t)y)
             CGOTOXY(1, line_cur, GOTO_STAT);
+        for (const auto &op : line.ops)
+        {
+            if (op.type == FSOP_COLOUR)
+                textcolour(op.x);
+            else
+                CPRINTF("%s", op.text.c_str());
         }
+        clear_to_end_of_line();
+        ++line_cur;
     }
 #ifdef USE_TILE_LOCAL
     }
@@ -1506,6 +1549,9 @@ void redraw_screen()
     you.wield_change         = true;
     you.redraw_quiver        = true;
     you.redraw_status_lights = true;
+    // The border wipe invalidated whatever the light cache thinks is on
+    // screen.
+    _last_lights_y = -1;
 
     print_stats();
 
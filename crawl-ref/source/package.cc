@@ -651,6 +651,26 @@ plen_t package::get_chunk_fragmentation(const string &name)
     return frags;
 }
 
+// Compare a chunk's stored (compressed) bytes against a new payload
+// without decompressing either side.
+bool package::chunk_identical(const string &name, const vector<char> &data)
+{
+    auto ci = directory.find(name);
+    if (ci == directory.end())
+        return false;
+
+    chunk_reader rd(this, ci->second);
+    char buf[4096];
+    size_t off = 0;
+    while (plen_t got = rd.raw_read(buf, sizeof(buf)))
+    {
+        if (off + got > data.size() || memcmp(buf, &data[off], got))
+            return false;
+        off += got;
+    }
+    return off == data.size();
+}
+
 plen_t package::get_chunk_compressed_length(const string &name)
 {
     load_traces();
@@ -687,7 +707,18 @@ chunk_writer::chunk_writer(package *parent, const string &_name)
     zs.zalloc    = 0;
     zs.zfree     = 0;
     zs.opaque    = Z_NULL;
-    if (deflateInit(&zs, Z_DEFAULT_COMPRESSION))
+    // Chunk writes happen on the game thread during level transitions
+    // and autosaves, so favour deflate speed over ratio; the few percent
+    // of extra save size is a good trade for the shorter stall.
+    //
+    // The payload format is a bare zlib stream with no preset dictionary.
+    // Small chunks ("you", notes, short level deltas) would compress
+    // better with shared context, but any change to the bytes a reader
+    // has to expect -- a preset dictionary, a different codec -- also
+    // needs a file_header version bump and a matching path in
+    // chunk_reader; the version byte currently only selects the
+    // directory layout in read_directory().
+    if (deflateInit(&zs, Z_BEST_SPEED))
         fail("save file compression failed during init: %s", zs.msg);
 #define ZB_SIZE 32768
     zs.next_out  = z_buffer = (Bytef*)malloc(ZB_SIZE);
@@ -719,7 +750,7 @@ chunk_writer::~chunk_writer()
         res = deflate(&zs, Z_FINISH);
         if (res != Z_STREAM_END && res != Z_OK && res != Z_BUF_ERROR)
             fail("save file compression failed: %s", zs.msg);
-        raw_write(z_buffer, zs.next_out - z_buffer);
+        payload.insert(payload.end(), (char*)z_buffer, (char*)zs.next_out);
         zs.next_out = z_buffer;
         zs.avail_out = ZB_SIZE;
     } while (res != Z_STREAM_END);
@@ -727,6 +758,16 @@ chunk_writer::~chunk_writer()
         fail("save file compression failed during clean-up: %s", zs.msg);
     free(z_buffer);
 #endif
+
+    // Chunks are rewritten wholesale even when their content hasn't
+    // changed -- levels the player merely passed through are the common
+    // case. If the stored bytes already match, keep the old block chain
+    // and skip the write (and the commit churn) entirely.
+    if (pkg->chunk_identical(name, payload))
+        return;
+
+    if (!payload.empty())
+        raw_write(&payload[0], payload.size());
     if (cur_block)
         finish_block(0);
     pkg->finish_chunk(name, first_block);
@@ -783,7 +824,7 @@ void chunk_writer::write(const void *data, plen_t len)
     {
         if (!zs.avail_out)
         {
-            raw_write(z_buffer, zs.next_out - z_buffer);
+            payload.insert(payload.end(), (char*)z_buffer, (char*)zs.next_out);
             zs.next_out  = z_buffer;
             zs.avail_out = ZB_SIZE;
         }
@@ -792,7 +833,7 @@ void chunk_writer::write(const void *data, plen_t len)
             fail("save file compression failed: %s", zs.msg);
     }
 #else
-    raw_write(data, len);
+    payload.insert(payload.end(), (const char*)data, (const char*)data + len);
 #endif
 }
 
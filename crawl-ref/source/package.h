@@ -32,6 +32,7 @@ private:
     z_stream zs;
     Bytef *z_buffer;
 #endif
+    vector<char> payload;
     void raw_write(const void *data, plen_t len);
     void finish_block(plen_t next);
 public:
@@ -81,6 +82,7 @@ public:
     // statistics
     plen_t get_slack();
     plen_t get_size() const { return file_len; };
+    const string &get_filename() const { return filename; };
     plen_t get_chunk_fragmentation(const string &name);
     plen_t get_chunk_compressed_length(const string &name);
 private:
@@ -114,6 +116,7 @@ private:
     void trace_chunk(plen_t start);
     void load();
     void load_traces();
+    bool chunk_identical(const string &name, const vector<char> &data);
     friend class chunk_writer;
     friend class chunk_reader;
 };
@@ -135,6 +135,15 @@ text_pattern::~text_pattern()
         _free_compiled_pattern(compiled_pattern);
 }
 
+// A pattern with no regex metacharacters matches exactly the strings a
+// plain substring search for it would find, so the regex engine can be
+// bypassed for it entirely. Most user patterns (force_more_message,
+// menu_colour and the like) are such literals.
+bool text_pattern::literal_pattern(const string &s)
+{
+    return s.find_first_of("\\^$.[]()|*+?{}") == string::npos;
+}
+
 const text_pattern &text_pattern::operator= (const text_pattern &tp)
 {
     if (this == &tp)
@@ -146,6 +155,7 @@ const text_pattern &text_pattern::operator= (const text_pattern &tp)
     compiled_pattern = nullptr;
     isvalid      = tp.isvalid;
     ignore_case  = tp.ignore_case;
+    is_literal   = tp.is_literal;
     return *this;
 }
 
@@ -159,6 +169,7 @@ const text_pattern &text_pattern::operator= (const string &spattern)
     pattern = spattern;
     compiled_pattern = nullptr;
     isvalid = true;
+    is_literal = literal_pattern(spattern);
     // We don't change ignore_case
     return *this;
 }
@@ -180,11 +191,32 @@ bool text_pattern::compile() const
 
 bool text_pattern::matches(const char *s, int length) const
 {
+    if (is_literal && !empty())
+    {
+        const string haystack(s, length);
+        if (!ignore_case)
+            return haystack.find(pattern) != string::npos;
+        return lowercase_string(haystack).find(lowercase_string(pattern))
+               != string::npos;
+    }
     return valid() && _pattern_match(compiled_pattern, s, length);
 }
 
 pattern_match text_pattern::match_location(const char *s, int length) const
 {
+    if (is_literal && !empty())
+    {
+        const string haystack(s, length);
+        const size_t pos = ignore_case
+            ? lowercase_string(haystack).find(lowercase_string(pattern))
+            : haystack.find(pattern);
+        if (pos != string::npos)
+        {
+            return pattern_match::succeeded(haystack, pos,
+                                            pos + pattern.length());
+        }
+        return pattern_match::failed(haystack);
+    }
     if (valid())
         return _pattern_match_location(compiled_pattern, s, length);
     else
@@ -55,13 +55,14 @@ class text_pattern : public base_pattern
 public:
     text_pattern(const string &s, bool icase = false)
         : pattern(s), compiled_pattern(nullptr),
-          isvalid(true), ignore_case(icase)
+          isvalid(true), ignore_case(icase),
+          is_literal(literal_pattern(s))
     {
     }
 
     text_pattern()
         : pattern(), compiled_pattern(nullptr),
-         isvalid(false), ignore_case(false)
+         isvalid(false), ignore_case(false), is_literal(true)
     {
     }
 
@@ -70,7 +71,8 @@ public:
           pattern(tp.pattern),
           compiled_pattern(nullptr),
           isvalid(tp.isvalid),
-          ignore_case(tp.ignore_case)
+          ignore_case(tp.ignore_case),
+          is_literal(tp.is_literal)
     {
     }
 
@@ -118,10 +120,15 @@ public:
     }
 
 private:
+    static bool literal_pattern(const string &s);
+
     string pattern;
     mutable void *compiled_pattern;
     mutable bool isvalid;
     bool ignore_case;
+    // Patterns without regex metacharacters are matched with a plain
+    // substring search, skipping the regex engine.
+    bool is_literal;
 };
 
 class plaintext_pattern : public base_pattern
@@ -95,9 +95,21 @@ namespace perlin
         49,192,214, 31,181,199,106,157,184, 84,204,176,115,121,50,45,127, 4,150,254,
         138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180};
 
+    // perm[x] % 12, precomputed: the gradient hash is taken several times
+    // per sample and the modulo showed up clearly in abyss profiles.
+    static struct perm_mod12_table
+    {
+        uint8_t val[ARRAYSZ(perm)];
+        perm_mod12_table()
+        {
+            for (unsigned int i = 0; i < ARRAYSZ(perm); ++i)
+                val[i] = perm[i] % 12;
+        }
+    } perm_mod12;
+
     static IMMUTABLE uint8_t permMod12(const uint32_t x)
     {
-        return perm[x] % 12;
+        return perm_mod12.val[x];
     }
 
     // Skewing and unskewing factors for 2, 3, and 4 dimensions
@@ -429,6 +441,12 @@ namespace perlin
         if (octaves == 1)
             return noise(x, y, z);
 
+        // The constant rotation applied between octaves; hoisted because
+        // sin/cos of the literal were being recomputed for every octave
+        // of every sample.
+        static const double rot_s = sin(1.41421356);
+        static const double rot_c = cos(1.41421356);
+
         uint32_t divisor = 1;
         double norm = 0.0;
         double value = 0;
@@ -440,8 +458,8 @@ namespace perlin
             value += noise(xi / divisor, yi / divisor, zi / divisor) / divisor;
             norm += 1 / divisor;
             divisor *= 2;
-            double xt = yi * sin(1.41421356) + cos(1.41421356);
-            yi = yi * cos(1.41421356) + sin(1.41421356);
+            double xt = yi * rot_s + rot_c;
+            yi = yi * rot_c + rot_s;
             xi = xt;
             zi += 1.7;
         }
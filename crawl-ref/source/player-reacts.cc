@@ -856,9 +856,15 @@ static void _decrement_durations()
         you.duration[DUR_SANGUINE_ARMOUR] = 1; // expire
 
     // these should be after decr_ambrosia, transforms, liquefying, etc.
+    // Only touch durations that are actually running: the inactive ones
+    // (almost all of NUM_DURATIONS, almost every turn) would fetch all
+    // their end/midpoint metadata just to no-op on a zero counter.
     for (int i = 0; i < NUM_DURATIONS; ++i)
-        if (duration_decrements_normally((duration_type) i))
-            _decrement_simple_duration((duration_type) i, delay);
+    {
+        const duration_type dur = (duration_type) i;
+        if (you.duration[dur] > 0 && duration_decrements_normally(dur))
+            _decrement_simple_duration(dur, delay);
+    }
 }
 
 
@@ -548,18 +548,21 @@ void move_player_to_grid(const coord_def& p, bool stepped)
 bool is_feat_dangerous(dungeon_feature_type grid, bool permanently,
                        bool ignore_flight)
 {
+    // Only deep water and lava can ever be dangerous; settle the common
+    // case with two comparisons before looking at flight, which walks
+    // durations and attributes. This runs for every cell movement
+    // touches, player and monster alike.
+    if (grid != DNGN_DEEP_WATER && grid != DNGN_LAVA)
+        return false;
+
     if (!ignore_flight
         && (you.permanent_flight() || you.airborne() && !permanently))
     {
         return false;
     }
-    else if (grid == DNGN_DEEP_WATER && !player_likes_water(permanently)
-             || grid == DNGN_LAVA && !player_likes_lava(permanently))
-    {
-        return true;
-    }
-    else
-        return false;
+
+    return grid == DNGN_DEEP_WATER && !player_likes_water(permanently)
+           || grid == DNGN_LAVA && !player_likes_lava(permanently);
 }
 
 bool is_map_persistent()
@@ -289,6 +289,13 @@ void player_quiver::on_weapon_changed()
 
 void player_quiver::on_inv_quantity_changed(int slot, int amt)
 {
+    // Only missiles can enter the fire order, so a quantity change on
+    // anything else can neither fill nor displace the quiver. This gets
+    // called for every stack change in the inventory; skip the fire
+    // order rescan for the irrelevant ones.
+    if (you.inv[slot].defined() && you.inv[slot].base_type != OBJ_MISSILES)
+        return;
+
     if (m_last_used_of_type[m_last_used_type].base_type == OBJ_UNASSIGNED)
     {
         // Empty quiver. Maybe we can fill it now?
@@ -14,16 +14,61 @@
 
 static FixedVector<PcgRNG, NUM_RNGS> rngs;
 
+// Where RNG_GAMEPLAY requests are actually served from. The level builder
+// redirects them to RNG_LEVELGEN so that a level's generation draws from
+// its own deterministically seeded stream and can be replayed from
+// (game seed, level) without the rest of the game's randomness in between.
+static int _gameplay_rng = RNG_GAMEPLAY;
+
+static vector<FixedVector<PcgRNG, NUM_RNGS>> _saved_rng_states;
+
+// Save and restore the full generator state, so that a block of code can
+// run on its own (re)seeded random number stream without perturbing the
+// game's. Used by the fight simulator for reproducible statistics runs.
+void push_rng_state()
+{
+    _saved_rng_states.push_back(rngs);
+}
+
+void pop_rng_state()
+{
+    ASSERT(!_saved_rng_states.empty());
+    rngs = _saved_rng_states.back();
+    _saved_rng_states.pop_back();
+}
+
 uint32_t get_uint32(int generator)
 {
+    if (generator == RNG_GAMEPLAY)
+        generator = _gameplay_rng;
     return rngs[generator].get_uint32();
 }
 
 uint64_t get_uint64(int generator)
 {
+    if (generator == RNG_GAMEPLAY)
+        generator = _gameplay_rng;
     return rngs[generator].get_uint64();
 }
 
+rng_redirect::rng_redirect(int generator)
+    : previous(_gameplay_rng)
+{
+    _gameplay_rng = generator;
+}
+
+rng_redirect::~rng_redirect()
+{
+    _gameplay_rng = previous;
+}
+
+// Reseed a single stream, leaving the others alone. Used by the level
+// builder to key RNG_LEVELGEN off the game seed and the level being built.
+void seed_rng_stream(int generator, uint64_t seed_array[], int seed_len)
+{
+    rngs[generator] = PcgRNG(seed_array, seed_len);
+}
+
 static void _seed_rng(uint64_t seed_array[], int seed_len)
 {
     PcgRNG seeded(seed_array, seed_len);
@@ -94,16 +139,24 @@ static int _random2(int max, int rng)
     if (max <= 1)
         return 0;
 
-    uint32_t partn = PcgRNG::max() / max;
-
-    while (true)
+    // Lemire's multiply-and-shift reduction: map the full 32-bit PCG
+    // output onto [0, max) with one widening multiply. The common case
+    // needs no division at all; only when the low half lands in the
+    // (tiny) biased fragment do we pay for the exact threshold and
+    // reroll, keeping the result perfectly uniform.
+    const uint32_t n = (uint32_t)max;
+    uint64_t m = (uint64_t)get_uint32(rng) * n;
+    uint32_t low = (uint32_t)m;
+    if (low < n)
     {
-        uint32_t bits = get_uint32(rng);
-        uint32_t val  = bits / partn;
-
-        if (val < (uint32_t)max)
-            return (int)val;
+        const uint32_t thresh = (uint32_t)(-n) % n;
+        while (low < thresh)
+        {
+            m = (uint64_t)get_uint32(rng) * n;
+            low = (uint32_t)m;
+        }
     }
+    return (int)(m >> 32);
 }
 
 // [0, max)
@@ -11,6 +11,22 @@
 void seed_rng();
 void seed_rng(uint32_t seed);
 void seed_rng(uint64_t[], int);
+void seed_rng_stream(int generator, uint64_t[], int);
+
+// Serve RNG_GAMEPLAY requests from another stream for this object's
+// lifetime. Unwinds on scope exit, including thrown exceptions.
+class rng_redirect
+{
+public:
+    rng_redirect(int generator);
+    ~rng_redirect();
+
+private:
+    int previous;
+};
+
+void push_rng_state();
+void pop_rng_state();
 
 uint32_t get_uint32(int generator = RNG_GAMEPLAY);
 uint64_t get_uint64(int generator = RNG_GAMEPLAY);
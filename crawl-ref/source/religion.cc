@@ -2225,13 +2225,8 @@ void set_piety(int piety)
 
 static void _gain_piety_point()
 {
-    // check to see if we owe anything first
-    if (player_under_penance(you.religion))
-    {
-        dec_penance(1);
-        return;
-    }
-    else if (you.gift_timeout > 0)
+    // Penance has already been paid off in gain_piety().
+    if (you.gift_timeout > 0)
     {
         you.gift_timeout--;
 
@@ -2342,10 +2337,6 @@ static void _gain_piety_point()
         }
     }
 
-    // The player's symbol depends on Beogh piety.
-    if (you_worship(GOD_BEOGH))
-        update_player_symbol();
-
     if (have_passive(passive_t::stat_boost)
         && chei_stat_boost(old_piety) < chei_stat_boost())
     {
@@ -2357,18 +2348,6 @@ static void _gain_piety_point()
         notify_stat_change();
     }
 
-    if (you_worship(GOD_QAZLAL)
-        && qazlal_sh_boost(old_piety) != qazlal_sh_boost())
-    {
-        you.redraw_armour_class = true;
-    }
-
-    if (have_passive(passive_t::halo) || have_passive(passive_t::umbra))
-    {
-        // Piety change affects halo / umbra radius.
-        invalidate_agrid(true);
-    }
-
     do_god_gift();
 }
 
@@ -2401,8 +2380,47 @@ bool gain_piety(int original_gain, int denominator, bool should_scale_piety)
         pgn = sprint_modify_piety(pgn);
 
     pgn = div_rand_round(pgn, denominator);
-    while (pgn-- > 0)
-        _gain_piety_point();
+
+    // Points that fall due while under penance just work the penance
+    // off; hand them to dec_penance in one batch instead of re-running
+    // its mollification checks once per point. The boundary behaviour
+    // (messages, notes, passives returning) is the same either way.
+    if (player_under_penance(you.religion))
+    {
+        const int penance_paid = min<int>(pgn, you.penance[you.religion]);
+        dec_penance(penance_paid);
+        pgn -= penance_paid;
+    }
+
+    if (pgn > 0)
+    {
+        const int old_piety = you.piety;
+        while (pgn-- > 0)
+            _gain_piety_point();
+
+        // Side effects that depend only on the final piety, hoisted out
+        // of the per-point loop. Mass-kill turns fire dozens of small
+        // gains; no need to rebuild these once per point.
+
+        // The player's symbol depends on Beogh piety.
+        if (you_worship(GOD_BEOGH))
+            update_player_symbol();
+
+        if (you_worship(GOD_QAZLAL)
+            && qazlal_sh_boost(old_piety) != qazlal_sh_boost())
+        {
+            you.redraw_armour_class = true;
+        }
+
+        if (you.piety != old_piety
+            && (have_passive(passive_t::halo)
+                || have_passive(passive_t::umbra)))
+        {
+            // Piety change affects halo / umbra radius.
+            invalidate_agrid(true);
+        }
+    }
+
     if (you.piety > you.piety_max[you.religion])
     {
         if (you.piety >= piety_breakpoint(5)
@@ -4334,7 +4352,28 @@ int get_monster_tension(const monster* mons, god_type god)
     return exper;
 }
 
-int get_tension(god_type god)
+// Tension queries repeat within a turn -- god wrath checks, Xom's mood,
+// and monster AI simulating door closures can all ask several times --
+// and each one walks every cell in sight. Answer repeats from a
+// one-entry cache. Everything monster-side that feeds the calculation
+// funnels through actor movement, terrain changes, enchantment updates,
+// damage, healing, behaviour events or attitude changes, all of which
+// bump the epoch below; the player-side inputs are folded into the key.
+static int _tension_epoch = 0;
+
+void invalidate_tension_cache()
+{
+    _tension_epoch++;
+}
+
+// The epoch also keys other caches over the same monster state, such as
+// Zin's recite audience scan in godabil.cc.
+int tension_cache_epoch()
+{
+    return _tension_epoch;
+}
+
+static int _calc_tension(god_type god)
 {
     int total = 0;
 
@@ -4415,6 +4454,26 @@ int get_tension(god_type god)
     return max(0, tension);
 }
 
+int get_tension(god_type god)
+{
+    static god_type cached_god = NUM_GODS;
+    static int cached_epoch = -1;
+    static int cached_time = -1;
+    static int cached_hp = -1;
+    static int cached_tension = 0;
+
+    if (god != cached_god || _tension_epoch != cached_epoch
+        || you.elapsed_time != cached_time || you.hp != cached_hp)
+    {
+        cached_tension = _calc_tension(god);
+        cached_god = god;
+        cached_epoch = _tension_epoch;
+        cached_time = you.elapsed_time;
+        cached_hp = you.hp;
+    }
+    return cached_tension;
+}
+
 int get_fuzzied_monster_difficulty(const monster *mons)
 {
     double factor = sqrt(exp_needed(you.experience_level) / 30.0);
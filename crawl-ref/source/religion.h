@@ -134,6 +134,8 @@ void religion_turn_end();
 
 int get_tension(god_type god = you.religion);
 int get_monster_tension(const monster* mons, god_type god = you.religion);
+void invalidate_tension_cache();
+int tension_cache_epoch();
 int get_fuzzied_monster_difficulty(const monster *mons);
 
 typedef void (*delayed_callback)(const mgen_data &mg, monster *&mon, int placed);
@@ -22,6 +22,12 @@
 
 #define TIMER_KEY "timer"
 
+// The earliest aut at which anything on the current level's floor can rot,
+// cached in the level props by the last full sweep so that sweeps before
+// then can return without walking all of mitm. Corpses store 0 here (they
+// tick every sweep); a level with no rotting items at all stores INT_MAX.
+#define NEXT_ROT_DUE_KEY "next_rot_due"
+
 static bool _is_chunk(const item_def &item);
 static bool _item_needs_rot_check(const item_def &item);
 static int _get_initial_stack_longevity(const item_def &stack);
@@ -171,14 +177,16 @@ static bool _item_needs_rot_check(const item_def &item)
     if (!item.defined())
         return false;
 
-    if (item.props.exists(CORPSE_NEVER_DECAYS))
+    // Settle by type before probing the props hash; only chunks, blood
+    // potions and corpses can rot at all.
+    if (!is_perishable_stack(item)
+        && (item.base_type != OBJ_CORPSES
+            || item.sub_type > CORPSE_SKELETON)) // XXX: is this needed?
+    {
         return false;
+    }
 
-    if (is_perishable_stack(item))
-        return true;
-
-    return item.base_type == OBJ_CORPSES
-           && item.sub_type <= CORPSE_SKELETON; // XXX: is this needed?
+    return !item.props.exists(CORPSE_NEVER_DECAYS);
 }
 
 /**
@@ -314,6 +322,16 @@ static int _rot_stack(item_def &it, int slot, bool in_inv)
     return destroyed_count;
 }
 
+/**
+ * Forget the current level's cached no-rot-before time, typically because
+ * a perishable item just landed on the floor and may be due to rot sooner
+ * than anything the last sweep saw.
+ */
+void reset_rot_schedule()
+{
+    env.properties.erase(NEXT_ROT_DUE_KEY);
+}
+
 /**
  * Decay items on the floor: corpses, chunks, and Gozag gold auras.
  *
@@ -324,7 +342,17 @@ void rot_floor_items(int elapsedTime)
     if (elapsedTime <= 0)
         return;
 
+    // Chunk and blood timers are absolute, so if the last sweep found
+    // nothing due before now (and no corpses, whose freshness ticks down
+    // every sweep), this one is a provable no-op.
+    if (env.properties.exists(NEXT_ROT_DUE_KEY)
+        && you.elapsed_time < env.properties[NEXT_ROT_DUE_KEY].get_int())
+    {
+        return;
+    }
+
     const int rot_time = elapsedTime / ROT_TIME_FACTOR;
+    int next_due = INT_MAX;
 
     for (int mitm_index = 0; mitm_index < MAX_ITEMS; ++mitm_index)
     {
@@ -334,10 +362,31 @@ void rot_floor_items(int elapsedTime)
             continue;
 
         if (it.base_type == OBJ_CORPSES)
+        {
             _rot_corpse(it, mitm_index, rot_time);
+            // Corpse freshness is read between sweeps (butchery quality,
+            // stash tracking), so corpses keep the level on the regular
+            // schedule.
+            next_due = 0;
+        }
         else
+        {
             _rot_stack(it, mitm_index, false);
+            if (it.defined() && it.props.exists(TIMER_KEY))
+            {
+                const CrawlVector &timer = it.props[TIMER_KEY].get_vector();
+                if (!timer.empty())
+                {
+                    // Timers are sorted descending; the rearmost is due
+                    // first.
+                    next_due = min(next_due,
+                                   timer[timer.size() - 1].get_int());
+                }
+            }
+        }
     }
+
+    env.properties[NEXT_ROT_DUE_KEY].get_int() = next_due;
 }
 
 /**
@@ -25,6 +25,7 @@ void merge_perishable_stacks(const item_def &source, item_def &dest, int quant);
 
 void rot_inventory_food(int time_delta);
 void rot_floor_items(int elapsedTime);
+void reset_rot_schedule();
 
 
 #endif
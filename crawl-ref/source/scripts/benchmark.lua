@@ -0,0 +1,67 @@
+-- Microbenchmarks for a few of the engine's hot paths: LOS updates,
+-- travel flood-fills, level generation and level (un)marshalling.
+--
+-- Run as: crawl -script benchmark [<iters>]
+-- or:     make benchmark
+--
+-- Each benchmark reseeds the RNG with a fixed value before running, so
+-- results are comparable from one run (and one build) to the next.
+-- Results go to stderr, one line per benchmark, in a stable form meant
+-- for scripts rather than eyes:
+--   BENCH <name> iters=<n> total_ms=<ms> mean_us=<us>
+
+local args = script.simple_args()
+local forced_iters = #args > 0 and tonumber(args[1]) or nil
+
+-- Arbitrary, but fixed: changing this invalidates comparisons with
+-- older benchmark runs.
+local SEED = 1729
+
+local function bench(name, default_iters, run)
+  local iters = forced_iters or default_iters
+  debug.reset_rng(SEED)
+  local start = crawl.millis()
+  for i = 1, iters do
+    run(i)
+  end
+  local total = crawl.millis() - start
+  crawl.stderr(string.format("BENCH %s iters=%d total_ms=%d mean_us=%d",
+                             name, iters, total,
+                             math.floor(total * 1000 / iters)))
+end
+
+-- All benchmarks run on the same deterministically generated level.
+debug.reset_rng(SEED)
+test.regenerate_level("D:3", true)
+
+-- Invalidate the global LOS cache, then query visibility from the
+-- player's position, forcing a full LOS recomputation around it.
+bench("los_update", 2000,
+      function ()
+        debug.los_changed()
+        local x, y = you.pos()
+        los.cell_see_cell(x, y, x + 1, y)
+      end)
+
+-- Flood-fill the level from the player's position, as travel and
+-- explore do.
+bench("travel_flood", 500,
+      function ()
+        debug.travel_flood()
+      end)
+
+-- Marshall the current level to a memory buffer and unmarshall it
+-- again: the save/load cost of a level change, minus the disk.
+bench("level_marshall", 100,
+      function ()
+        debug.marshall_level()
+      end)
+
+-- Build fresh levels, each from its own fixed seed. By far the most
+-- expensive benchmark here; keep it last so partial output from an
+-- interrupted run still covers the cheap ones.
+bench("level_gen", 20,
+      function (i)
+        debug.reset_rng(SEED + i)
+        test.regenerate_level(nil, true)
+      end)
@@ -878,8 +878,9 @@ bool is_worthless_consumable(const item_def &item)
 static int _count_identical(const vector<item_def>& stock, const item_def& item)
 {
     int count = 0;
+    const string name = ShoppingList::item_name_simple(item);
     for (const item_def& other : stock)
-        if (ShoppingList::items_are_same(item, other))
+        if (name == ShoppingList::item_name_simple(other))
             count++;
 
     return count;
@@ -1993,6 +1994,20 @@ bool ShoppingList::cull_identical_items(const item_def& item, int cost)
     return to_del.size();
 }
 
+static int _ident_batch_depth = 0;
+static vector<pair<object_class_type, int>> _pending_type_idents;
+
+shoplist_ident_batch::shoplist_ident_batch()
+{
+    _ident_batch_depth++;
+}
+
+shoplist_ident_batch::~shoplist_ident_batch()
+{
+    if (--_ident_batch_depth == 0 && !_pending_type_idents.empty())
+        shopping_list.flush_pending_type_idents();
+}
+
 void ShoppingList::item_type_identified(object_class_type base_type,
                                         int sub_type)
 {
@@ -2000,6 +2015,17 @@ void ShoppingList::item_type_identified(object_class_type base_type,
     if (!crawl_state.need_save)
         return;
 
+    if (_ident_batch_depth)
+    {
+        const pair<object_class_type, int> type(base_type, sub_type);
+        if (find(_pending_type_idents.begin(), _pending_type_idents.end(),
+                 type) == _pending_type_idents.end())
+        {
+            _pending_type_idents.push_back(type);
+        }
+        return;
+    }
+
     // Only restore the excursion at the very end.
     level_excursion le;
 
@@ -2039,6 +2065,58 @@ void ShoppingList::item_type_identified(object_class_type base_type,
     refresh();
 }
 
+// Reprice everything a just-closed identification batch recorded, with
+// a single excursion shared across all the identified types.
+void ShoppingList::flush_pending_type_idents()
+{
+    vector<pair<object_class_type, int>> types;
+    types.swap(_pending_type_idents);
+
+    if (!crawl_state.need_save)
+        return;
+
+    level_excursion le;
+
+#if TAG_MAJOR_VERSION == 34
+    if (!you.props.exists(REMOVED_DEAD_SHOPS_KEY))
+    {
+        remove_dead_shops();
+        you.props[REMOVED_DEAD_SHOPS_KEY] = true;
+    }
+#endif
+
+    bool any_matched = false;
+    for (CrawlHashTable &thing : *list)
+    {
+        if (!thing_is_item(thing))
+            continue;
+
+        const item_def& item = get_thing_item(thing);
+
+        if (find(types.begin(), types.end(),
+                 make_pair(item.base_type, (int)item.sub_type))
+            == types.end())
+        {
+            continue;
+        }
+        any_matched = true;
+
+        const level_pos place = thing_pos(thing);
+
+        le.go_to(place.id);
+        const shop_struct *shop = shop_at(place.pos);
+        ASSERT(shop);
+        if (shoptype_identifies_stock(shop->type))
+            continue;
+
+        thing[SHOPPING_THING_COST_KEY] =
+            _shop_get_item_value(item, shop->greed, false);
+    }
+
+    if (any_matched)
+        refresh();
+}
+
 void ShoppingList::remove_dead_shops()
 {
     // Only restore the excursion at the very end.
@@ -2245,22 +2323,31 @@ void ShoppingList::fill_out_menu(Menu& shopmenu)
     menu_letter hotkey;
     int longest = 0;
     // How much space does the longest entry need for proper alignment?
+    // The position descriptions are derived strings, so build them once
+    // here instead of a second time in the entry loop below.
+    vector<string> pos_descs;
     for (const CrawlHashTable &thing : *list)
-        longest = max(longest, strwidth(describe_thing_pos(thing)));
+    {
+        pos_descs.push_back(describe_thing_pos(thing));
+        longest = max(longest, strwidth(pos_descs.back()));
+    }
 
-    for (CrawlHashTable &thing : *list)
+    for (unsigned int i = 0; i < list->size(); i++)
     {
+        CrawlHashTable &thing = (*list)[i];
         const int cost = thing_cost(thing);
         const bool unknown = thing_is_item(thing)
                              && shop_item_unknown(get_thing_item(thing));
 
+        const string name = name_thing(thing, DESC_A);
+
         const string etitle =
             make_stringf(
                 "%*s%5d gold  %s%s",
                 longest,
-                describe_thing_pos(thing).c_str(),
+                pos_descs[i].c_str(),
                 cost,
-                name_thing(thing, DESC_A).c_str(),
+                name.c_str(),
                 unknown ? " (unknown)" : "");
 
         MenuEntry *me = new MenuEntry(etitle, MEL_ITEM, 1, hotkey);
@@ -2270,12 +2357,12 @@ void ShoppingList::fill_out_menu(Menu& shopmenu)
             me->colour = DARKGREY;
         else if (thing_is_item(thing))
         {
-            // Colour shopping list item according to menu colours.
+            // Colour shopping list item according to menu colours; for
+            // items, name_thing() above is already the DESC_A item name.
             const item_def &item = get_thing_item(thing);
 
             const string colprf = item_prefix(item);
-            const int col = menu_colour(item.name(DESC_A),
-                                        colprf, "shop");
+            const int col = menu_colour(name, colprf, "shop");
 
             if (col != -1)
                 me->colour = col;
@@ -2451,6 +2538,10 @@ void ShoppingList::refresh()
 int ShoppingList::find_thing(const item_def &item,
                              const level_pos &pos) const
 {
+    // The query item's name doesn't change per entry; derive it once
+    // rather than once per list element.
+    const string name = item_name_simple(item);
+
     for (unsigned int i = 0; i < list->size(); i++)
     {
         const CrawlHashTable &thing = (*list)[i];
@@ -2464,7 +2555,7 @@ int ShoppingList::find_thing(const item_def &item,
 
         const item_def &_item = get_thing_item(thing);
 
-        if (item_name_simple(item) == item_name_simple(_item))
+        if (name == item_name_simple(_item))
             return i;
     }
 
@@ -44,6 +44,18 @@ struct level_pos;
 class  Menu;
 
 typedef pair<string, int> shoplist_entry;
+// While alive, ShoppingList::item_type_identified() only records the
+// identified types; the outermost batch reprices them all on
+// destruction in one level excursion. Identification by elimination
+// can cascade through several types at once, and without batching each
+// one pays its own excursion to every level with a matching list entry.
+class shoplist_ident_batch
+{
+public:
+    shoplist_ident_batch();
+    ~shoplist_ident_batch();
+};
+
 class ShoppingList
 {
 public:
@@ -64,6 +76,7 @@ public:
 
     void item_type_identified(object_class_type base_type, int sub_type);
     bool cull_identical_items(const item_def& item, int cost = -1);
+    void flush_pending_type_idents();
     void remove_dead_shops();
 
     void gold_changed(int old_amount, int new_amount);
@@ -82,6 +95,7 @@ public:
 
     static bool items_are_same(const item_def& item_a,
                                const item_def& item_b);
+    static string item_name_simple(const item_def& item, bool ident = false);
 
 private:
     CrawlVector* list;
@@ -110,7 +124,6 @@ private:
                              description_level_type descrip = DESC_PLAIN);
     static string describe_thing(const CrawlHashTable& thing,
                                  description_level_type descrip = DESC_PLAIN);
-    static string item_name_simple(const item_def& item, bool ident = false);
 };
 
 extern ShoppingList shopping_list;
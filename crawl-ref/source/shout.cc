@@ -763,16 +763,23 @@ void yell(const actor* mon)
 
 void apply_noises()
 {
-    // [ds] This copying isn't awesome, but we cannot otherwise handle
-    // the case where one set of noises wakes up monsters who then let
-    // out yips of their own, modifying _noise_grid while it is in the
-    // middle of propagate_noise().
+    // Propagate on a separate grid, since one set of noises can wake up
+    // monsters who then let out yips of their own, and those must go to
+    // _noise_grid (for the next apply_noises()) rather than modify a grid
+    // in the middle of propagate_noise(). The scratch grid is reused
+    // across calls: resetting it only touches the cells the last noise
+    // actually flooded, where copying _noise_grid wholesale touched the
+    // entire level's worth of cells every time.
     if (_noise_grid.dirty())
     {
-        noise_grid copy = _noise_grid;
-        // Reset the main grid.
-        _noise_grid.reset();
-        copy.propagate_noise();
+        static noise_grid propagation_grid;
+        static vector<noise_t> pending;
+
+        _noise_grid.take_noises(pending);
+        for (const noise_t &noise : pending)
+            propagation_grid.register_noise(noise);
+        propagation_grid.propagate_noise();
+        propagation_grid.reset();
     }
 }
 
@@ -983,17 +990,33 @@ int noise_cell::turn_angle(const coord_def &next_delta) const
 }
 
 noise_grid::noise_grid()
-    : cells(), noises(), affected_actor_count(0)
+    : cells(), noises(), dirty_cells(), affected_actor_count(0)
 {
 }
 
 void noise_grid::reset()
 {
-    cells.init(noise_cell());
+    // Clearing cell by cell beats re-initialising the whole array as
+    // long as the noise didn't flood a sizable chunk of the level.
+    if (dirty_cells.size() * 8 > GXM * GYM)
+        cells.init(noise_cell());
+    else
+    {
+        for (const coord_def &p : dirty_cells)
+            cells(p) = noise_cell();
+    }
+    dirty_cells.clear();
     noises.clear();
     affected_actor_count = 0;
 }
 
+void noise_grid::take_noises(vector<noise_t> &dest)
+{
+    dest.clear();
+    dest.swap(noises);
+    reset();
+}
+
 void noise_grid::register_noise(const noise_t &noise)
 {
     noise_cell &target_cell(cells(noise.noise_source));
@@ -1006,6 +1029,7 @@ void noise_grid::register_noise(const noise_t &noise)
                                               noise_index,
                                               0,
                                               coord_def(0, 0));
+        dirty_cells.push_back(noise.noise_source);
     }
 }
 
@@ -1115,9 +1139,12 @@ bool noise_grid::propagate_noise_to_neighbour(int base_attenuation,
                                   cell.noise_id,
                                   travel_distance,
                                   next_pos - current_pos))
+        {
+            dirty_cells.push_back(next_pos);
             // Return true only if we hadn't already registered this
             // cell as a neighbour (presumably with a lower volume).
             return neighbour_old_distance != travel_distance;
+        }
     }
     return false;
 }
@@ -839,6 +839,14 @@ bool is_magic_skill(skill_type sk)
 void train_skills(bool simu)
 {
     int cost, exp;
+
+    // Nothing to spend: common during kill floods, where each corpse in a
+    // cascade calls gain_exp() but the pool stays capped below one raise.
+    // No skill points can move, so the level re-check and training reset
+    // below would only confirm what's already true.
+    if (you.exp_available < calc_skill_cost(you.skill_cost_level))
+        return;
+
     do
     {
         cost = calc_skill_cost(you.skill_cost_level);
@@ -1491,7 +1499,25 @@ int skill_bump(skill_type skill, int scale)
 
 float apt_to_factor(int apt)
 {
-    return 1 / exp(log(2) * apt / APT_DOUBLE);
+    // The training loop funnels every skill point through here (via
+    // skill_exp_needed()), and exp() dwarfs the surrounding integer
+    // arithmetic. The function is pure, so the cache needs no
+    // invalidation; aptitudes outside the table (e.g. UNUSABLE_SKILL)
+    // just fall back to computing directly.
+    static const int apt_cache_min = -50, apt_cache_max = 50;
+    static float apt_cache[apt_cache_max - apt_cache_min + 1];
+    static bool apt_cached[apt_cache_max - apt_cache_min + 1];
+
+    if (apt < apt_cache_min || apt > apt_cache_max)
+        return 1 / exp(log(2) * apt / APT_DOUBLE);
+
+    const int i = apt - apt_cache_min;
+    if (!apt_cached[i])
+    {
+        apt_cache[i] = 1 / exp(log(2) * apt / APT_DOUBLE);
+        apt_cached[i] = true;
+    }
+    return apt_cache[i];
 }
 
 unsigned int skill_exp_needed(int lev, skill_type sk, species_type sp)
@@ -1534,26 +1560,37 @@ float species_apt_factor(skill_type sk, species_type sp)
     return apt_to_factor(species_apt(sk, sp));
 }
 
-vector<skill_type> get_crosstrain_skills(skill_type sk)
+const vector<skill_type> &get_crosstrain_skills(skill_type sk)
 {
+    // Every player::skill() query iterates this, so hand out references
+    // to fixed tables rather than building a vector per call.
+    static const vector<skill_type> none;
+    static const vector<skill_type> short_blades = { SK_LONG_BLADES };
+    static const vector<skill_type> long_blades  = { SK_SHORT_BLADES };
+    static const vector<skill_type> axes_staves  = { SK_POLEARMS,
+                                                     SK_MACES_FLAILS };
+    static const vector<skill_type> maces_pole   = { SK_AXES, SK_STAVES };
+    static const vector<skill_type> slings       = { SK_THROWING };
+    static const vector<skill_type> throwing     = { SK_SLINGS };
+
     switch (sk)
     {
     case SK_SHORT_BLADES:
-        return { SK_LONG_BLADES };
+        return short_blades;
     case SK_LONG_BLADES:
-        return { SK_SHORT_BLADES };
+        return long_blades;
     case SK_AXES:
     case SK_STAVES:
-        return { SK_POLEARMS, SK_MACES_FLAILS };
+        return axes_staves;
     case SK_MACES_FLAILS:
     case SK_POLEARMS:
-        return { SK_AXES, SK_STAVES };
+        return maces_pole;
     case SK_SLINGS:
-        return { SK_THROWING };
+        return slings;
     case SK_THROWING:
-        return { SK_SLINGS };
+        return throwing;
     default:
-        return {};
+        return none;
     }
 }
 
@@ -513,15 +513,64 @@ static bool _get_mem_list(spell_list &mem_spells,
     return false;
 }
 
+// Everything the memorisation list depends on -- carried and floor
+// books, known spells, XL, free spell levels, forms, god gifts -- only
+// changes as game time passes (or in wizard mode, which the extra key
+// components below catch). The tiles memorisation panel rebuilds the
+// list on every redraw, so memoize it between state changes.
+struct mem_list_key
+{
+    time_t game; // distinguishes games within one crawl session
+    int time;
+    int turns;
+    int xl;
+    int spell_no;
+
+    mem_list_key() : game(0), time(-1), turns(-1), xl(-1), spell_no(-1) { }
+
+    static mem_list_key current()
+    {
+        mem_list_key k;
+        k.game = you.birth_time;
+        k.time = you.elapsed_time;
+        k.turns = you.num_turns;
+        k.xl = you.experience_level;
+        k.spell_no = you.spell_no;
+        return k;
+    }
+
+    bool operator==(const mem_list_key &other) const
+    {
+        return game == other.game && time == other.time
+               && turns == other.turns && xl == other.xl
+               && spell_no == other.spell_no;
+    }
+};
+
 // If current_spell is a valid spell, returns whether you'll be able to
 // memorise any further spells once this one is committed to memory.
 bool has_spells_to_memorise(bool silent, spell_type current_spell)
 {
+    static mem_list_key cache_key;
+    static bool cached_result = false;
+
+    // Only memoize the silent query with no spell pending; the other
+    // variants print explanatory prompts or answer a different question.
+    const bool cacheable = silent && current_spell == SPELL_NO_SPELL;
+    if (cacheable && cache_key == mem_list_key::current())
+        return cached_result;
+
     spell_list      mem_spells;
     unsigned int    num_misc;
 
-    return _get_mem_list(mem_spells, num_misc, silent,
-                         (spell_type) current_spell);
+    const bool result = _get_mem_list(mem_spells, num_misc, silent,
+                                      (spell_type) current_spell);
+    if (cacheable)
+    {
+        cache_key = mem_list_key::current();
+        cached_result = result;
+    }
+    return result;
 }
 
 static bool _sort_mem_spells(spell_type a, spell_type b)
@@ -559,6 +608,14 @@ static bool _sort_mem_spells(spell_type a, spell_type b)
 
 vector<spell_type> get_mem_spell_list()
 {
+    // Only reuse non-empty results: the failure paths of _get_mem_list
+    // print their explanation, which a cache hit would swallow.
+    static mem_list_key cache_key;
+    static spell_list cached_spells;
+
+    if (!cached_spells.empty() && cache_key == mem_list_key::current())
+        return cached_spells;
+
     spell_list      mem_spells;
     unsigned int    num_misc;
 
@@ -567,6 +624,9 @@ vector<spell_type> get_mem_spell_list()
 
     sort(mem_spells.begin(), mem_spells.end(), _sort_mem_spells);
 
+    cache_key = mem_list_key::current();
+    cached_spells = mem_spells;
+
     return mem_spells;
 }
 
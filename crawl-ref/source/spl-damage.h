@@ -41,6 +41,7 @@ int wielding_rocks();
 spret_type cast_sandblast(int powc, bolt &beam, bool fail);
 spret_type cast_tornado(int powc, bool fail);
 void tornado_damage(actor *caster, int dur);
+void tornado_terrain_changed();
 void cancel_tornado(bool tloc = false);
 void tornado_move(const coord_def &pos);
 spret_type cast_thunderbolt(actor *caster, int pow, coord_def aim,
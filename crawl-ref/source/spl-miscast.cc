@@ -187,8 +187,10 @@ void MiscastEffect::init()
     if (special_source == MELEE_MISCAST)
         source_known = false;
 
-    if (hand_str.empty())
-        target->hand_name(true, &can_plural_hand);
+    // Whether @hands@ pluralise is only needed by the few effects that
+    // mention them; plural_hand() computes it on first use rather than
+    // building a throwaway hand name for every miscast here.
+    hand_plural_known = !hand_str.empty();
 
     // Explosion stuff.
     beam.is_explosion = true;
@@ -222,6 +224,18 @@ bool MiscastEffect::neither_end_silenced()
     return !silenced(you.pos()) && !silenced(target->pos());
 }
 
+// Lazily resolve whether the target's @hands@ pluralise: hand_name()
+// builds a string we throw away, so don't ask until a message needs it.
+bool MiscastEffect::plural_hand()
+{
+    if (!hand_plural_known)
+    {
+        target->hand_name(true, &can_plural_hand);
+        hand_plural_known = true;
+    }
+    return can_plural_hand;
+}
+
 void MiscastEffect::do_miscast()
 {
     ASSERT_RANGE(recursion_depth, 0, MAX_RECURSE);
@@ -246,12 +260,14 @@ void MiscastEffect::do_miscast()
 
     if (spell != SPELL_NO_SPELL)
     {
-        vector<spschool_flag_type> school_list;
+        // Pick a school uniformly without building a list: keeping the
+        // k-th match with probability 1/k leaves each equally likely.
+        int matches = 0;
+        sp_type = SPTYP_NONE;
         for (const auto bit : spschools_type::range())
-            if (spell_typematch(spell, bit))
-                school_list.push_back(bit);
-
-        sp_type = school_list[random2(school_list.size())];
+            if (spell_typematch(spell, bit) && one_chance_in(++matches))
+                sp_type = bit;
+        ASSERT(matches > 0);
     }
     else
     {
@@ -893,7 +909,7 @@ void MiscastEffect::_hexes(int severity)
         switch (random2(10))
         {
         case 0:
-            _your_hands_glow(target, you_msg, mon_msg_seen, can_plural_hand);
+            _your_hands_glow(target, you_msg, mon_msg_seen, plural_hand());
             break;
         case 1:
             you_msg      = "You feel off-balance for a moment.";
@@ -1037,7 +1053,7 @@ void MiscastEffect::_charms(int severity)
         switch (random2(10))
         {
         case 0:
-            _your_hands_glow(target, you_msg, mon_msg_seen, can_plural_hand);
+            _your_hands_glow(target, you_msg, mon_msg_seen, plural_hand());
             break;
         case 1:
             you_msg      = "The air around you crackles with energy!";
@@ -1994,7 +2010,7 @@ void MiscastEffect::_transmutation(int severity)
         switch (random2(num))
         {
         case 0:
-            _your_hands_glow(target, you_msg, mon_msg_seen, can_plural_hand);
+            _your_hands_glow(target, you_msg, mon_msg_seen, plural_hand());
             break;
         case 1:
             you_msg        = "The air around you crackles with energy!";
@@ -2729,11 +2745,7 @@ void MiscastEffect::_air(int severity)
             if (special_source == HELL_EFFECT_MISCAST)
                 all_msg = "Sparks of electricity dance around you.";
 
-            bool pluralised = true;
-            if (!hand_str.empty())
-                pluralised = can_plural_hand;
-            else
-                target->hand_name(true, &pluralised);
+            const bool pluralised = plural_hand();
 
             if (pluralised)
             {
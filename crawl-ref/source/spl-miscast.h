@@ -88,6 +88,7 @@ private:
 
     string hand_str;
     bool        can_plural_hand;
+    bool        hand_plural_known;
 
     bool source_known;
     bool target_known;
@@ -112,6 +113,7 @@ private:
     string get_default_cause(bool attribute_to_user) const;
 
     bool neither_end_silenced();
+    bool plural_hand();
 
     void do_msg(bool suppress_nothing_happens = false);
     bool _ouch(int dam, beam_type flavour = BEAM_NONE);
@@ -47,7 +47,7 @@ class WindSystem
     void pass_wind(coord_def c);
 public:
     WindSystem(coord_def _org);
-    bool has_wind(coord_def c);
+    bool has_wind(coord_def c) const;
 };
 
 WindSystem::WindSystem(coord_def _org)
@@ -97,12 +97,36 @@ void WindSystem::pass_wind(coord_def c)
             pass_wind(*ai);
 }
 
-bool WindSystem::has_wind(coord_def c)
+bool WindSystem::has_wind(coord_def c) const
 {
     ASSERT(grid_distance(c, org) <= TORNADO_RADIUS); // might say no instead
     return wind(c - org);
 }
 
+// Terrain is the only input to the wind decomposition besides the centre,
+// and multi-turn tornados keep asking about the same centre, so keep the
+// last system around until set_terrain_changed() tells us it's stale.
+static unique_ptr<WindSystem> _wind_cache;
+static coord_def _wind_cache_org;
+static level_id _wind_cache_level;
+
+void tornado_terrain_changed()
+{
+    _wind_cache.reset();
+}
+
+static const WindSystem &_get_winds(coord_def org)
+{
+    if (!_wind_cache || _wind_cache_org != org
+        || _wind_cache_level != level_id::current())
+    {
+        _wind_cache.reset(new WindSystem(org));
+        _wind_cache_org = org;
+        _wind_cache_level = level_id::current();
+    }
+    return *_wind_cache;
+}
+
 static void _set_tornado_durations(int powc)
 {
     int dur = 60;
@@ -187,6 +211,24 @@ static double _get_ang(int x, int y)
     }
 }
 
+// The pseudo-angle depends only on the offset from the centre, so tally
+// the whole annulus once instead of redoing the divisions for every
+// candidate square of every rotated actor, every turn.
+static double _offset_ang(coord_def off)
+{
+    static SquareArray<double, TORNADO_RADIUS> angs;
+    static bool init = false;
+    if (!init)
+    {
+        for (int y = -TORNADO_RADIUS; y <= TORNADO_RADIUS; y++)
+            for (int x = -TORNADO_RADIUS; x <= TORNADO_RADIUS; x++)
+                if (x || y)
+                    angs(coord_def(x, y)) = _get_ang(x, y);
+        init = true;
+    }
+    return angs(off);
+}
+
 static coord_def _rotate(coord_def org, coord_def from,
                          vector<coord_def> &avail, int rdur)
 {
@@ -197,12 +239,12 @@ static coord_def _rotate(coord_def org, coord_def from,
     double hiscore = DBL_MAX;
 
     double dist0 = (from - org).rdist();
-    double ang0 = _get_ang(from.x - org.x, from.y - org.y) - rdur * 0.01 * 4 / 3;
+    double ang0 = _offset_ang(from - org) - rdur * 0.01 * 4 / 3;
     for (coord_def pos : avail)
     {
         double dist = (pos - org).rdist();
         double distdiff = fabs(dist - dist0);
-        double ang = _get_ang(pos.x - org.x, pos.y - org.y);
+        double ang = _offset_ang(pos - org);
         double angdiff = min(fabs(ang - ang0), fabs(ang - ang0 - 8));
 
         double score = distdiff + angdiff * 3 / 2;
@@ -258,7 +300,8 @@ void tornado_damage(actor *caster, int dur)
     dprf("Doing tornado, dur %d, effective power %d", dur, pow);
     const coord_def org = caster->pos();
     int noise = 0;
-    WindSystem winds(org);
+    // Copied, not referenced: felling a tree below invalidates the cache.
+    const WindSystem winds(_get_winds(org));
 
     const coord_def old_player_pos = you.pos();
     coord_def new_player_pos = old_player_pos;
@@ -519,8 +562,7 @@ void tornado_move(const coord_def &p)
     if (age > _age_needed(dist))
     {
         // check for actual wind too, not just the radius
-        WindSystem winds(you.pos());
-        if (winds.has_wind(p))
+        if (_get_winds(you.pos()).has_wind(p))
         {
             // blinking/cTele inside an already windy area
             dprf("Tloc penalty: reducing tornado by %d turns", dist - 1);
@@ -75,7 +75,10 @@ struct spell_desc
 
 #include "spl-data.h"
 
-static int spell_list[NUM_SPELLS];
+// Dense table mapping spell_type directly to its spelldata entry
+// (nullptr for removed/invalid spells), so every property lookup is a
+// single array read.
+static const spell_desc *spell_list[NUM_SPELLS];
 
 #define SPELLDATASIZE ARRAYSZ(spelldata)
 
@@ -89,7 +92,7 @@ static const struct spell_desc *_seekspell(spell_type spellid);
 void init_spell_descs()
 {
     for (int i = 0; i < NUM_SPELLS; i++)
-        spell_list[i] = -1;
+        spell_list[i] = nullptr;
 
     for (unsigned int i = 0; i < SPELLDATASIZE; i++)
     {
@@ -114,7 +117,7 @@ void init_spell_descs()
         ASSERTM(!(data.flags & SPFLAG_MONSTER && is_player_spell(data.id)),
                 "spell '%s' is declared as a monster spell but is a player spell", data.title);
 
-        spell_list[data.id] = i;
+        spell_list[data.id] = &data;
     }
 }
 
@@ -915,16 +918,16 @@ spschool_flag_type skill2spell_type(skill_type spell_skill)
 static const spell_desc *_seekspell(spell_type spell)
 {
     ASSERT_RANGE(spell, 0, NUM_SPELLS);
-    const int index = spell_list[spell];
-    ASSERT(index != -1);
+    const spell_desc *desc = spell_list[spell];
+    ASSERT(desc);
 
-    return &spelldata[index];
+    return desc;
 }
 
 bool is_valid_spell(spell_type spell)
 {
     return spell > SPELL_NO_SPELL && spell < NUM_SPELLS
-           && spell_list[spell] != -1;
+           && spell_list[spell] != nullptr;
 }
 
 static bool _spell_range_varies(spell_type spell)
@@ -1025,8 +1025,12 @@ static void _update_level_state()
             env.level_state |= LSTATE_STILL_WINDS;
     }
     for (rectangle_iterator ri(0); ri; ++ri)
+    {
         if (grd(*ri) == DNGN_SLIMY_WALL)
             env.level_state |= LSTATE_SLIMY_WALL;
+        if (feat_is_watery(grd(*ri)))
+            env.level_state |= LSTATE_WATERY;
+    }
 
     env.orb_pos = coord_def();
     if (item_def* orb = find_floor_item(OBJ_ORBS, ORB_ZOT))
@@ -73,7 +73,9 @@ static void _initialize()
 
     you.symbol = MONS_PLAYER;
 
-    seed_rng();
+    // Recording or replaying an input journal takes over RNG seeding.
+    if (!journal_seed_rng())
+        seed_rng();
 
     init_char_table(Options.char_set);
     init_show_table();
@@ -154,8 +156,14 @@ static void _initialize()
     }
 #endif
 
-    if (Options.seed)
-        seed_rng(Options.seed);
+    const uint32_t fixed_seed = journal_replay_active()
+                                ? journal_replayed_fixed_seed()
+                                : Options.seed;
+    if (fixed_seed)
+    {
+        seed_rng(fixed_seed);
+        journal_note_fixed_seed(fixed_seed);
+    }
 
 #ifdef DEBUG_STATISTICS
     if (crawl_state.map_stat_gen)
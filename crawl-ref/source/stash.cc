@@ -96,6 +96,16 @@ string stash_annotate_item(const char *s, const item_def *item, bool exclusive)
     return text;
 }
 
+// Bumped whenever something that can change stash item names globally
+// happens (type identification, autopickup rule changes); per-stash
+// search text caches older than this are rebuilt on the next search.
+static int _stash_name_gen = 0;
+
+void invalidate_stash_search_cache()
+{
+    _stash_name_gen++;
+}
+
 void maybe_update_stashes()
 {
     if (!crawl_state.game_is_arena())
@@ -165,7 +175,7 @@ static void _fully_identify_item(item_def *item)
 // Stash
 // ----------------------------------------------------------------------
 
-Stash::Stash(coord_def pos_) : items()
+Stash::Stash(coord_def pos_) : items(), search_texts(), search_text_gen(-1)
 {
     // First, fix what square we're interested in
     if (pos_.origin())
@@ -239,17 +249,52 @@ static bool _grid_has_perceived_multiple_items(const coord_def& pos)
     return count > 1;
 }
 
+static bool _is_rottable(const item_def &item);
+
+// Does the pile at pos still match the items we recorded? Compares only
+// the fields a floor item can change without being relinked; rottables
+// always count as changed, since the recorded copy repurposes plus2 for
+// stash_freshness.
+static bool _pile_unchanged(const coord_def &pos,
+                            const vector<item_def> &items)
+{
+    size_t i = 0;
+    for (stack_iterator si(pos, true); si; ++si, ++i)
+    {
+        if (i >= items.size())
+            return false;
+        const item_def &old = items[i];
+        if (_is_rottable(old)
+            || si->base_type != old.base_type
+            || si->sub_type != old.sub_type
+            || si->plus != old.plus
+            || si->plus2 != old.plus2
+            || si->special != old.special
+            || si->quantity != old.quantity
+            || si->flags != old.flags
+            || si->inscription != old.inscription)
+        {
+            return false;
+        }
+    }
+    return i == items.size();
+}
+
 bool Stash::unmark_trapping_nets()
 {
     bool changed = false;
     for (auto &item : items)
         if (item_is_stationary_net(item))
             item.net_placed = false, changed = true;
+    if (changed)
+        _invalidate_search_text();
     return changed;
 }
 
 void Stash::update()
 {
+    const dungeon_feature_type old_feat = feat;
+    const trap_type old_trap = trap;
     feat = grd(pos);
     trap = NUM_TRAPS;
 
@@ -271,6 +316,19 @@ void Stash::update()
     // If this is your position, you know what's on this square
     if (pos == you.pos())
     {
+        // Rebuilding the item list deep-copies every item on the square
+        // (props and all), and update_visible_stashes() gets us here for
+        // the player's square every turn. If neither the feature nor the
+        // pile changed since we last looked, keep the recorded items and
+        // the cached search text.
+        if (verified && feat == old_feat && trap == old_trap
+            && _pile_unchanged(pos, items))
+        {
+            return;
+        }
+
+        _invalidate_search_text();
+
         // Zap existing items
         items.clear();
 
@@ -284,6 +342,8 @@ void Stash::update()
     // what the player sees on the square is the first item in this vector.
     else
     {
+        _invalidate_search_text();
+
         if (!_grid_has_perceived_item(pos))
         {
             items.clear();
@@ -445,16 +505,38 @@ vector<stash_search_result> Stash::matches_search(
     if (empty())
         return results;
 
-    for (const item_def &item : items)
+    // Generating item names and running the Lua annotator for every
+    // item on every search is what makes ctrl-F slow in long games, so
+    // the search strings are cached and rebuilt only after something
+    // that can change them (see _invalidate_search_text() callers and
+    // invalidate_stash_search_cache()).
+    if (search_text_gen != _stash_name_gen
+        || search_texts.size() != items.size())
+    {
+        search_texts.clear();
+        search_texts.reserve(items.size());
+        for (const item_def &item : items)
+        {
+            search_text st;
+            st.match = stash_item_name(item);
+            st.haystack = stash_annotate_item(STASH_LUA_SEARCH_ANNOTATE, &item)
+                          + " " + st.match;
+            if (is_dumpable_artefact(item))
+                st.dump = chardump_desc(item);
+            search_texts.push_back(st);
+        }
+        search_text_gen = _stash_name_gen;
+    }
+
+    for (size_t i = 0; i < items.size(); i++)
     {
-        const string s   = stash_item_name(item);
-        const string ann = stash_annotate_item(STASH_LUA_SEARCH_ANNOTATE, &item);
-        if (search.matches(prefix + " " + ann + " " + s)
-            || is_dumpable_artefact(item) && search.matches(chardump_desc(item)))
+        const search_text &st = search_texts[i];
+        if (search.matches(prefix + " " + st.haystack)
+            || !st.dump.empty() && search.matches(st.dump))
         {
             stash_search_result res;
-            res.match = s;
-            res.item = item;
+            res.match = st.match;
+            res.item = items[i];
             results.push_back(res);
         }
     }
@@ -490,8 +572,12 @@ void Stash::_update_corpses(int rot_time)
         if (new_rot <= _min_rot(item))
         {
             items.erase(items.begin() + i);
+            _invalidate_search_text();
             continue;
         }
+        // The name grows a suffix when the corpse skeletalises.
+        if (item.stash_freshness > 0 && new_rot <= 0)
+            _invalidate_search_text();
         item.stash_freshness = static_cast<short>(new_rot);
     }
 }
@@ -500,13 +586,18 @@ void Stash::_update_identification()
 {
     for (int i = items.size() - 1; i >= 0; i--)
     {
+        const iflags_t oldflags = items[i].flags;
         god_id_item(items[i]);
         maybe_identify_base_type(items[i]);
+        if (items[i].flags != oldflags)
+            _invalidate_search_text();
     }
 }
 
 void Stash::add_item(const item_def &item, bool add_to_front)
 {
+    _invalidate_search_text();
+
     if (_is_rottable(item))
         StashTrack.update_corpses();
 
@@ -603,6 +694,8 @@ void Stash::save(writer& outf) const
 
 void Stash::load(reader& inf)
 {
+    _invalidate_search_text();
+
     // How many items?
     int count = unmarshallShort(inf);
 
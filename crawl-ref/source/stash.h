@@ -75,6 +75,17 @@ private:
 
     vector<item_def> items;
 
+    // Lazily rebuilt per-item search strings; see matches_search().
+    struct search_text
+    {
+        string match;    // stash_item_name() output
+        string haystack; // Lua search annotation + " " + match
+        string dump;     // chardump text for dumpable artefacts
+    };
+    mutable vector<search_text> search_texts;
+    mutable int search_text_gen;
+    void _invalidate_search_text() { search_text_gen = -1; }
+
     static bool are_items_same(const item_def &, const item_def &,
                                bool exact = false);
 
@@ -322,6 +333,7 @@ extern StashTracker StashTrack;
 
 void maybe_update_stashes();
 bool is_stash(const coord_def& c);
+void invalidate_stash_search_cache();
 string get_stash_desc(const coord_def& c);
 void describe_stash(const coord_def& c);
 
@@ -74,6 +74,11 @@ struct game_state
 
     string sprint_map;      // Sprint map set on command line, if any.
 
+    // Input journal paths set on the command line (-record / -replay);
+    // see macro.cc for the journal itself.
+    string journal_record;
+    string journal_replay;
+
     string map;             // Map selected in the newgame menu
 
     void (*terminal_resize_handler)();
@@ -136,6 +136,18 @@ CrawlStoreValue::CrawlStoreValue(const CrawlStoreValue &other)
     }
 }
 
+CrawlStoreValue::CrawlStoreValue(CrawlStoreValue &&other)
+    : type(other.type), flags(other.flags), val(other.val)
+{
+    ASSERT_RANGE(other.type, SV_NONE, NUM_STORE_VAL_TYPES);
+
+    // The payload pointer now belongs to us; leave other with nothing
+    // to delete.
+    other.type    = SV_NONE;
+    other.flags   = SFLAG_UNSET;
+    other.val.ptr = nullptr;
+}
+
 CrawlStoreValue::CrawlStoreValue(const store_flags _flags,
                                  const store_val_type _type)
     : type(_type), flags(_flags)
@@ -191,6 +203,13 @@ CrawlStoreValue::CrawlStoreValue(const string &_val)
     get_string() = _val;
 }
 
+CrawlStoreValue::CrawlStoreValue(string &&_val)
+    : type(SV_STR), flags(SFLAG_UNSET)
+{
+    val.ptr = nullptr;
+    get_string() = move(_val);
+}
+
 CrawlStoreValue::CrawlStoreValue(const char* _val)
     : type(SV_STR), flags(SFLAG_UNSET)
 {
@@ -452,6 +471,35 @@ CrawlStoreValue &CrawlStoreValue::operator = (const CrawlStoreValue &other)
     return *this;
 }
 
+CrawlStoreValue &CrawlStoreValue::operator = (CrawlStoreValue &&other)
+{
+    ASSERT_RANGE(other.type, SV_NONE, NUM_STORE_VAL_TYPES);
+    ASSERT(other.type != SV_NONE || type == SV_NONE);
+
+    // Same checks as copy assignment above.
+    if (!(flags & SFLAG_UNSET))
+    {
+        if (flags & SFLAG_CONST_TYPE)
+            ASSERT(type == SV_NONE || type == other.type);
+    }
+
+    if (this == &other)
+        return *this;
+
+    // Free whatever we held, then steal other's payload.
+    unset(true);
+
+    type  = other.type;
+    flags = other.flags;
+    val   = other.val;
+
+    other.type    = SV_NONE;
+    other.flags   = SFLAG_UNSET;
+    other.val.ptr = nullptr;
+
+    return *this;
+}
+
 ///////////////////////////////////
 // Meta-data accessors and changers
 store_flags CrawlStoreValue::get_flags() const
@@ -476,6 +524,58 @@ store_val_type CrawlStoreValue::get_type() const
     return type;
 }
 
+// Rough number of bytes this value owns beyond its own struct: string
+// capacities, heap payloads and container nodes, but not allocator
+// slop. Drives the wizmode memory report.
+size_t CrawlStoreValue::estimate_size() const
+{
+    switch (type)
+    {
+    case SV_STR:
+        return sizeof(string) + static_cast<string *>(val.ptr)->capacity();
+
+    case SV_COORD:
+        return sizeof(coord_def);
+
+    case SV_ITEM:
+    {
+        const item_def &item = *static_cast<item_def *>(val.ptr);
+        return sizeof(item_def) + item.props.estimate_size();
+    }
+
+    case SV_HASH:
+    {
+        const CrawlHashTable &table = *static_cast<CrawlHashTable *>(val.ptr);
+        return sizeof(CrawlHashTable) + table.estimate_size();
+    }
+
+    case SV_VEC:
+    {
+        const CrawlVector &vec = *static_cast<CrawlVector *>(val.ptr);
+        return sizeof(CrawlVector) + vec.estimate_size();
+    }
+
+    case SV_LEV_ID:
+        return sizeof(level_id);
+
+    case SV_LEV_POS:
+        return sizeof(level_pos);
+
+    case SV_MONST:
+    {
+        const monster &mon = *static_cast<monster *>(val.ptr);
+        return sizeof(monster) + mon.props.estimate_size();
+    }
+
+    case SV_LUA:
+        return static_cast<dlua_chunk *>(val.ptr)->estimate_size();
+
+    default:
+        // Scalars live in the union itself.
+        return 0;
+    }
+}
+
 //////////////////////////////
 // Read/write from/to savefile
 void CrawlStoreValue::write(writer &th) const
@@ -1113,6 +1213,12 @@ CrawlStoreValue &CrawlStoreValue::operator = (const string &_val)
     return *this;
 }
 
+CrawlStoreValue &CrawlStoreValue::operator = (string &&_val)
+{
+    get_string() = move(_val);
+    return *this;
+}
+
 CrawlStoreValue &CrawlStoreValue::operator = (const char* _val)
 {
     get_string() = _val;
@@ -1249,6 +1355,12 @@ CrawlHashTable::CrawlHashTable(const CrawlHashTable& other)
     hash_map = new hash_map_type(*(other.hash_map));
 }
 
+CrawlHashTable::CrawlHashTable(CrawlHashTable&& other)
+    : hash_map(other.hash_map)
+{
+    other.hash_map = nullptr;
+}
+
 CrawlHashTable::~CrawlHashTable()
 {
     // NOTE: Not using unique_ptr because making hash_map an unique_ptr
@@ -1276,8 +1388,76 @@ CrawlHashTable &CrawlHashTable::operator = (const CrawlHashTable &other)
     return *this;
 }
 
+CrawlHashTable &CrawlHashTable::operator = (CrawlHashTable &&other)
+{
+    if (this == &other)
+        return *this;
+
+    if (hash_map != nullptr)
+        delete hash_map;
+
+    hash_map = other.hash_map;
+    other.hash_map = nullptr;
+
+    return *this;
+}
+
 //////////////////////////////
 // Read/write from/to savefile
+// Prop keys that recur in nearly every save: every artefact carries the
+// four artefact keys, every corpse its naming keys, and so on. These are
+// marshalled as one-byte table indices instead of length-prefixed
+// strings, which both shrinks saves and skips a string alloc per entry
+// per load.
+//
+// The index is part of the save format: only ever append to this table,
+// and keep an entry (as a literal, not a shared #define) even if the
+// key it spells falls out of use.
+static const char *const _interned_prop_keys[] =
+{
+    "artefact_known_props", "artefact_props", "artefact_name",
+    "artefact_appearance",
+    "corpse_name_key", "corpse_name_type_key", "mangled_corpse",
+    "never_corpse", "forced_item_colour",
+    "orig_monster_key", "dbname", "band_leader", "blame", "no_annotate",
+    "speech_prefix", "foe", "foe_pos", "foe_approaching", "summon_id",
+    "base_position", "last_pos", "idle_deadline", "outwards", "inwards",
+    "corrosion_amount", "wand_known", "needs_autopickup",
+    "monster_tile", "monster_tile_name", "item_tile", "item_tile_name",
+    "worn_tile", "worn_tile_name", "tile_num",
+};
+
+static map<string, unsigned> _interned_key_ids;
+
+static void _marshall_table_key(writer &th, const string &key)
+{
+    if (_interned_key_ids.empty())
+    {
+        for (unsigned i = 0; i < ARRAYSZ(_interned_prop_keys); i++)
+            _interned_key_ids[_interned_prop_keys[i]] = i;
+    }
+
+    // Id 0 means a literal string follows; interned keys are stored as
+    // their table index plus one.
+    const unsigned *id = map_find(_interned_key_ids, key);
+    marshallUnsigned(th, id ? *id + 1 : 0);
+    if (!id)
+        marshallString(th, key);
+}
+
+static string _unmarshall_table_key(reader &th)
+{
+#if TAG_MAJOR_VERSION == 34
+    if (th.getMinorVersion() < TAG_MINOR_INTERNED_PROP_KEYS)
+        return unmarshallString(th);
+#endif
+    const unsigned id = unmarshallUnsigned(th);
+    if (!id)
+        return unmarshallString(th);
+    ASSERT(id <= ARRAYSZ(_interned_prop_keys));
+    return _interned_prop_keys[id - 1];
+}
+
 void CrawlHashTable::write(writer &th) const
 {
     ASSERT_VALIDITY();
@@ -1291,7 +1471,7 @@ void CrawlHashTable::write(writer &th) const
 
     for (const auto &entry : *hash_map)
     {
-        marshallString(th, entry.first);
+        _marshall_table_key(th, entry.first);
         entry.second.write(th);
     }
 
@@ -1321,7 +1501,7 @@ void CrawlHashTable::read(reader &th)
 
     for (unsigned int i = 0; i < _size; i++)
     {
-        string           key = unmarshallString(th);
+        string           key = _unmarshall_table_key(th);
         CrawlStoreValue &val = (*this)[key];
 
         val.read(th);
@@ -1460,6 +1640,21 @@ bool CrawlHashTable::empty() const
     return hash_map->empty();
 }
 
+size_t CrawlHashTable::estimate_size() const
+{
+    if (hash_map == nullptr)
+        return 0;
+
+    size_t bytes = sizeof(hash_map_type);
+    for (const auto &entry : *hash_map)
+    {
+        // Three pointers and a colour is roughly a red-black tree node.
+        bytes += sizeof(hash_map_type::value_type) + 4 * sizeof(void *)
+                 + entry.first.capacity() + entry.second.estimate_size();
+    }
+    return bytes;
+}
+
 void CrawlHashTable::erase(const string& key)
 {
     ASSERT_VALIDITY();
@@ -1778,6 +1973,14 @@ vec_size CrawlVector::size() const
     return vec.size();
 }
 
+size_t CrawlVector::estimate_size() const
+{
+    size_t bytes = vec.capacity() * sizeof(CrawlStoreValue);
+    for (const CrawlStoreValue &value : vec)
+        bytes += value.estimate_size();
+    return bytes;
+}
+
 bool CrawlVector::empty() const
 {
     return vec.empty();
@@ -1847,7 +2050,7 @@ void CrawlVector::push_back(CrawlStoreValue val)
         val.type   = type;
         val.flags |= SFLAG_CONST_TYPE;
     }
-    vec.push_back(val);
+    vec.push_back(move(val));
     ASSERT_VALIDITY();
 }
 
@@ -1864,7 +2067,7 @@ void CrawlVector::insert(const vec_size index, CrawlStoreValue val)
         val.type   = type;
         val.flags |= SFLAG_CONST_TYPE;
     }
-    vec.insert(vec.begin() + index, val);
+    vec.insert(vec.begin() + index, move(val));
 }
 
 void CrawlVector::resize(const vec_size _size)
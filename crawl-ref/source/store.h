@@ -78,6 +78,9 @@ class CrawlStoreValue
 public:
     CrawlStoreValue();
     CrawlStoreValue(const CrawlStoreValue &other);
+    // Stealing the payload pointer leaves other unset, as if freshly
+    // constructed.
+    CrawlStoreValue(CrawlStoreValue &&other);
 
     ~CrawlStoreValue();
 
@@ -98,8 +101,10 @@ public:
     CrawlStoreValue(const level_pos &val);
     CrawlStoreValue(const monster& val);
     CrawlStoreValue(const dlua_chunk &val);
+    CrawlStoreValue(string &&val);
 
     CrawlStoreValue &operator = (const CrawlStoreValue &other);
+    CrawlStoreValue &operator = (CrawlStoreValue &&other);
 
 protected:
     // These first two fields need to match those in CrawlVector
@@ -114,6 +119,8 @@ public:
     store_flags    unset_flags(store_flags flags);
     store_val_type get_type() const;
 
+    size_t estimate_size() const;
+
     CrawlHashTable &new_table();
 
     CrawlVector &new_vector(store_flags flags,
@@ -218,6 +225,7 @@ public:
     CrawlStoreValue &operator = (const level_pos &val);
     CrawlStoreValue &operator = (const monster& val);
     CrawlStoreValue &operator = (const dlua_chunk &val);
+    CrawlStoreValue &operator = (string &&val);
 
     // Misc operators
     string &operator += (const string &val);
@@ -252,6 +260,7 @@ class CrawlHashTable
 public:
     CrawlHashTable();
     CrawlHashTable(const CrawlHashTable& other);
+    CrawlHashTable(CrawlHashTable&& other);
 
     ~CrawlHashTable();
 
@@ -270,6 +279,7 @@ protected:
 
 public:
     CrawlHashTable &operator = (const CrawlHashTable &other);
+    CrawlHashTable &operator = (CrawlHashTable &&other);
 
     void write(writer &) const;
     void read(reader &);
@@ -306,6 +316,9 @@ public:
     unsigned int size() const;
     bool      empty() const;
 
+    // Rough deep size in bytes, for the wizmode memory report.
+    size_t estimate_size() const;
+
     void      erase(const string& key);
     void      erase(const char *key) { erase(string(key)); }
     void      clear();
@@ -329,6 +342,13 @@ public:
     CrawlVector(store_val_type type, store_flags flags = 0,
                 vec_size max_size = VEC_MAX_SIZE);
 
+    // The user-declared destructor would otherwise suppress the
+    // implicit moves, leaving element-wise deep copies.
+    CrawlVector(const CrawlVector &other) = default;
+    CrawlVector(CrawlVector &&other) = default;
+    CrawlVector &operator = (const CrawlVector &other) = default;
+    CrawlVector &operator = (CrawlVector &&other) = default;
+
     ~CrawlVector();
 
     typedef vector<CrawlStoreValue>     vector_type;
@@ -371,6 +391,9 @@ public:
     vec_size size() const;
     bool     empty() const;
 
+    // Rough deep size in bytes, for the wizmode memory report.
+    size_t estimate_size() const;
+
     // NOTE: push_back() and insert() have val passed by value rather
     // than by reference so that conversion constructors will work.
     CrawlStoreValue& pop_back();
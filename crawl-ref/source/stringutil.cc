@@ -147,7 +147,7 @@ string wordwrap_line(string &s, int width, bool tags, bool indent)
 
     while (int clen = utf8towc(&c, cp))
     {
-        int cw = wcwidth(c);
+        int cw = char_width(c);
         if (c == ' ')
             space = cp;
         else if (c == '\n')
@@ -195,6 +195,7 @@ enum tag_minor_version
     TAG_MINOR_DECUSTOM_CLOUDS,     // remove support for custom clouds
     TAG_MINOR_PAKELLAS_WRATH,      // fix Pakellas passive wrath not expiring
     TAG_MINOR_GLOBAL_BR_INFO,      // move global branch info to a reserved location
+    TAG_MINOR_INTERNED_PROP_KEYS,  // common prop keys as table indices
 #endif
     NUM_TAG_MINORS,
     TAG_MINOR_VERSION = NUM_TAG_MINORS - 1
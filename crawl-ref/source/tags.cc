@@ -34,9 +34,7 @@
 #include "art-enum.h"
 #include "branch.h"
 #include "butcher.h"
-#if TAG_MAJOR_VERSION == 34
- #include "cloud.h"
-#endif
+#include "cloud.h"
 #include "colour.h"
 #include "coordit.h"
 #include "dbg-scan.h"
@@ -54,6 +52,7 @@
 #include "jobs.h"
 #include "mapmark.h"
 #include "misc.h"
+#include "mutation.h"
 #include "mon-death.h"
 #if TAG_MAJOR_VERSION == 34
  #include "mon-place.h"
@@ -128,6 +127,16 @@ void reader::close()
 
 void reader::advance(size_t offset)
 {
+    // Plain files can seek and memory buffers can skip ahead directly,
+    // so don't pull the skipped bytes through fread. This matters for
+    // the map cache, where bodies sit at large offsets into the .dsc.
+    if (!_chunk)
+    {
+        if (offset)
+            read(nullptr, offset);
+        return;
+    }
+
     char junk[128];
 
     while (offset)
@@ -153,8 +162,14 @@ static NORETURN void _short_read(bool safe_read)
     die_noline("short read while reading save");
 }
 
-// Reads input in network byte order, from a file or buffer.
-unsigned char reader::readByte()
+void reader::shortRead()
+{
+    _short_read(_safe_read);
+}
+
+// Reads input in network byte order, from a file or save chunk; the
+// buffer case is inlined in tags.h.
+unsigned char reader::readByteExternal()
 {
     if (_file)
     {
@@ -163,22 +178,16 @@ unsigned char reader::readByte()
             _short_read(_safe_read);
         return b;
     }
-    else if (_chunk)
+    else
     {
         unsigned char buf;
         if (_chunk->read(&buf, 1) != 1)
             _short_read(_safe_read);
         return buf;
     }
-    else
-    {
-        if (_read_offset >= _pbuf->size())
-            _short_read(_safe_read);
-        return (*_pbuf)[_read_offset++];
-    }
 }
 
-void reader::read(void *data, size_t size)
+void reader::readExternal(void *data, size_t size)
 {
     if (_file)
     {
@@ -190,19 +199,10 @@ void reader::read(void *data, size_t size)
         else
             fseek(_file, (long)size, SEEK_CUR);
     }
-    else if (_chunk)
-    {
-        if (_chunk->read(data, size) != size)
-            _short_read(_safe_read);
-    }
     else
     {
-        if (_read_offset+size > _pbuf->size())
+        if (_chunk->read(data, size) != size)
             _short_read(_safe_read);
-        if (data && size)
-            memcpy(data, &(*_pbuf)[_read_offset], size);
-
-        _read_offset += size;
     }
 }
 
@@ -238,33 +238,26 @@ void writer::check_ok(bool ok)
     }
 }
 
-void writer::writeByte(unsigned char ch)
+void writer::writeByteExternal(unsigned char ch)
 {
     if (failed)
         return;
 
     if (_chunk)
         _chunk->write(&ch, 1);
-    else if (_file)
-        check_ok(fputc(ch, _file) != EOF);
     else
-        _pbuf->push_back(ch);
+        check_ok(fputc(ch, _file) != EOF);
 }
 
-void writer::write(const void *data, size_t size)
+void writer::writeExternal(const void *data, size_t size)
 {
     if (failed)
         return;
 
     if (_chunk)
         _chunk->write(data, size);
-    else if (_file)
-        check_ok(fwrite(data, 1, size, _file) == size);
     else
-    {
-        const unsigned char* cdata = static_cast<const unsigned char*>(data);
-        _pbuf->insert(_pbuf->end(), cdata, cdata+size);
-    }
+        check_ok(fwrite(data, 1, size, _file) == size);
 }
 
 long writer::tell()
@@ -1127,7 +1120,11 @@ static void _add_missing_branches()
 // tagId specifies what to write.
 void tag_write(tag_type tagID, writer &outf)
 {
-    vector<unsigned char> buf;
+    // The tag header needs the marshalled size up front, so everything is
+    // staged through a buffer; keep it across calls so a big level
+    // doesn't redo the growth reallocations on every save.
+    static vector<unsigned char> buf;
+    buf.clear();
     writer th(&buf);
     switch (tagID)
     {
@@ -2758,6 +2755,8 @@ static void tag_read_you(reader &th)
     for (int j = count; j < NUM_MUTATIONS; ++j)
         you.mutation[j] = you.innate_mutation[j] = you.sacrifices[j];
 
+    invalidate_mutation_cache();
+
 #if TAG_MAJOR_VERSION == 34
     if (th.getMinorVersion() < TAG_MINOR_NO_DEVICE_HEAL)
     {   // These use to apply no matter what the minor tag
@@ -4619,7 +4618,7 @@ void marshallMapCell(writer &th, const map_cell &cell)
 
     if (flags & MAP_SERIALIZE_CLOUD)
     {
-        cloud_info* ci = cell.cloudinfo();
+        const cloud_info* ci = cell.cloudinfo();
         marshallUnsigned(th, ci->type);
         marshallUnsigned(th, ci->colour);
         marshallUnsigned(th, ci->duration);
@@ -5412,6 +5411,7 @@ static void tag_read_level(reader &th)
 #endif
             env.cloud[cloud.pos] = cloud;
     }
+    rebuild_cloud_index();
 
     EAT_CANARY;
 
@@ -6018,6 +6018,9 @@ static void tag_read_level_monsters(reader &th)
     count = unmarshallShort(th);
     ASSERT_RANGE(count, 0, MAX_MONSTERS + 1);
 
+    // These slots are written directly, bypassing get_free_monster().
+    raise_monster_slot_watermark(count - 1);
+
     for (int i = 0; i < count; i++)
     {
         monster& m = menv[i];
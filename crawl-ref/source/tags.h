@@ -7,6 +7,7 @@
 #define TAGS_H
 
 #include <cstdio>
+#include <cstring>
 
 #include "package.h"
 
@@ -54,13 +55,36 @@ public:
 
     ~writer() { if (_chunk) delete _chunk; }
 
-    void writeByte(unsigned char byte);
-    void write(const void *data, size_t size);
+    // The tag constructors stage everything into a memory buffer (see
+    // tag_write), so inline that path and keep the file and chunk
+    // backends out of line.
+    void writeByte(unsigned char byte)
+    {
+        if (_pbuf)
+            _pbuf->push_back(byte);
+        else
+            writeByteExternal(byte);
+    }
+
+    void write(const void *data, size_t size)
+    {
+        if (_pbuf)
+        {
+            const unsigned char* cdata
+                = static_cast<const unsigned char*>(data);
+            _pbuf->insert(_pbuf->end(), cdata, cdata + size);
+        }
+        else
+            writeExternal(data, size);
+    }
+
     long tell();
 
     bool succeeded() const { return !failed; }
 
 private:
+    void writeByteExternal(unsigned char byte);
+    void writeExternal(const void *data, size_t size);
     void check_ok(bool ok);
 
 private:
@@ -108,8 +132,34 @@ public:
            int minorVersion = TAG_MINOR_INVALID);
     ~reader();
 
-    unsigned char readByte();
-    void read(void *data, size_t size);
+    // Tag bodies are deserialized from a borrowed memory buffer (see
+    // tag_read); make that hot path an inline bounds check and pointer
+    // bump instead of an out-of-line call per field.
+    unsigned char readByte()
+    {
+        if (_pbuf)
+        {
+            if (_read_offset >= _pbuf->size())
+                shortRead();
+            return (*_pbuf)[_read_offset++];
+        }
+        return readByteExternal();
+    }
+
+    void read(void *data, size_t size)
+    {
+        if (_pbuf)
+        {
+            if (_read_offset + size > _pbuf->size())
+                shortRead();
+            if (data && size)
+                memcpy(data, &(*_pbuf)[_read_offset], size);
+            _read_offset += size;
+        }
+        else
+            readExternal(data, size);
+    }
+
     void advance(size_t size);
     int getMinorVersion() const;
     void setMinorVersion(int minorVersion);
@@ -121,6 +171,11 @@ public:
 
     void set_safe_read(bool setting) { _safe_read = setting; }
 
+private:
+    unsigned char readByteExternal();
+    void readExternal(void *data, size_t size);
+    NORETURN void shortRead();
+
 private:
     string _filename;
     FILE* _file;
@@ -290,6 +290,7 @@ bool targetter_imb::set_aim(coord_def a)
         return false;
 
     vector<coord_def> cur_path;
+    cur_path.reserve(path_taken.size());
 
     splash.clear();
     splash2.clear();
@@ -16,6 +16,7 @@
 #include "coord.h"
 #include "coordit.h"
 #include "dgnevent.h"
+#include "dgn-shoals.h"
 #include "dgn-overview.h"
 #include "directn.h"
 #include "dungeon.h"
@@ -39,6 +40,7 @@
 #include "random.h"
 #include "religion.h"
 #include "species.h"
+#include "spl-damage.h"
 #include "spl-transloc.h"
 #include "state.h"
 #include "stringutil.h"
@@ -1190,6 +1192,11 @@ void dungeon_terrain_changed(const coord_def &pos,
 
     set_terrain_changed(pos);
 
+    // Terrain edits can change which squares the Shoals tide flows
+    // through; drop its cached shoreline.
+    if (player_in_branch(BRANCH_SHOALS))
+        shoals_terrain_changed();
+
     // Deal with doors being created by changing features.
     tile_init_flavour(pos);
 }
@@ -1887,6 +1894,8 @@ void set_terrain_changed(const coord_def p)
 
     if (grd(p) == DNGN_SLIMY_WALL)
         env.level_state |= LSTATE_SLIMY_WALL;
+    else if (feat_is_watery(grd(p)))
+        env.level_state |= LSTATE_WATERY;
     else if (grd(p) == DNGN_OPEN_DOOR)
     {
         // Restore colour from door-change markers
@@ -1913,6 +1922,10 @@ void set_terrain_changed(const coord_def p)
     dungeon_events.fire_position_event(DET_FEAT_CHANGE, p);
 
     los_terrain_changed(p);
+    tornado_terrain_changed();
+    invalidate_tension_cache();
+    invalidate_travel_distance_cache();
+    travel_stair_distances_dirty();
 
     for (orth_adjacent_iterator ai(p); ai; ++ai)
         if (actor *act = actor_at(*ai))
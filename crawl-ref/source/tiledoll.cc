@@ -6,6 +6,7 @@
 
 #include <sys/stat.h>
 
+#include "describe.h"
 #include "files.h"
 #include "mon-info.h"
 #include "options.h"
@@ -266,8 +267,65 @@ static tileidx_t _random_trousers()
     return TILEP_LEG_FIRST_NORM + offset % range;
 }
 
+// Everything fill_doll_equipment reads besides the doll itself: the
+// form, the equipped items' appearance, and the handful of mutations
+// and statuses with doll parts. Fingerprinting it lets the composed
+// doll be reused across redraws; the player tile is packed on every
+// viewport repack, but its appearance changes rarely.
+static uint32_t _doll_state_fingerprint(const dolls_data &doll)
+{
+    vector<int> state;
+    for (int i = 0; i < TILEP_PART_MAX; i++)
+        state.push_back(doll.parts[i]);
+
+    state.push_back(you.form);
+    state.push_back(you.species);
+    state.push_back(you.experience_level);
+    state.push_back(Options.tile_use_monster);
+    if (Options.tile_use_monster != MONS_0)
+        state.push_back(tileidx_player_mons());
+
+    for (int i = 0; i < NUM_EQUIP; i++)
+    {
+        state.push_back(you.equip[i]);
+        state.push_back(you.melded[i]);
+        if (you.equip[i] == -1)
+            continue;
+
+        const item_def &item = you.inv[you.equip[i]];
+        state.push_back(item.base_type);
+        state.push_back(item.sub_type);
+        state.push_back(item.special);
+        state.push_back(item.rnd);
+        if (item.base_type == OBJ_STAVES)
+            state.push_back(you.item_description[IDESC_STAVES][item.sub_type]);
+        if (item.props.exists("worn_tile"))
+            state.push_back(item.props["worn_tile"].get_short());
+    }
+
+    state.push_back(player_mutation_level(MUT_HORNS));
+    state.push_back(player_mutation_level(MUT_HOOVES));
+    state.push_back(player_mutation_level(MUT_TENTACLE_SPIKE));
+    state.push_back(you.has_claws(false));
+    state.push_back(you.haloed());
+    state.push_back(you.duration[DUR_LIQUID_FLAMES] != 0);
+
+    return hash32(state.data(), state.size() * sizeof(int));
+}
+
 void fill_doll_equipment(dolls_data &result)
 {
+    static dolls_data cached_doll;
+    static uint32_t cached_fingerprint = 0;
+    static bool have_cached = false;
+
+    const uint32_t fingerprint = _doll_state_fingerprint(result);
+    if (have_cached && fingerprint == cached_fingerprint)
+    {
+        result = cached_doll;
+        return;
+    }
+
     // Equipment-using forms
     switch (you.form)
     {
@@ -494,6 +552,10 @@ void fill_doll_equipment(dolls_data &result)
     for (int i = 0; i < TILEP_PART_MAX; i++)
         if (result.parts[i] == TILEP_SHOW_EQUIP)
             result.parts[i] = 0;
+
+    cached_doll = result;
+    cached_fingerprint = fingerprint;
+    have_cached = true;
 }
 
 // Writes equipment information into per-character doll file.
@@ -30,6 +30,23 @@ public:
                                   unsigned int width, unsigned int height,
                                   bool drop_shadow = false) = 0;
 
+    // Pack a textblock's quads into a caller-owned buffer that can be
+    // drawn on later frames without repacking. Returns false if the
+    // glyph atlas churned too much to pack the block in one piece; the
+    // caller should then fall back to render_textblock.
+    virtual bool pack_textblock(GLShapeBuffer &buf, const ucs_t *chars,
+                                const uint8_t *colours, unsigned int width,
+                                unsigned int height) = 0;
+
+    // Draw a buffer previously filled by pack_textblock.
+    virtual void draw_textblock_buffer(GLShapeBuffer &buf, unsigned int x,
+                                       unsigned int y,
+                                       bool drop_shadow = false) = 0;
+
+    // Bumped whenever a glyph slot in the atlas is reused; buffers
+    // packed under an older generation hold stale texture coords.
+    virtual unsigned int atlas_generation() const = 0;
+
     // render text + background box
     virtual void render_string(unsigned int x, unsigned int y,
                                const char *text, const coord_def &min_pos,
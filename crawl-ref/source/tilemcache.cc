@@ -153,9 +153,63 @@ mcache_manager::~mcache_manager()
     clear_all();
 }
 
+// Everything the renderer reads off an entry: the draw info list, the
+// doll (for ghosts) and transparency. Entries that agree on all three
+// are interchangeable.
+static uint32_t _entry_fingerprint(const mcache_entry *entry)
+{
+    tile_draw_info dinfo[mcache_entry::MAX_INFO_COUNT];
+    const int count = entry->info(dinfo);
+
+    uint32_t fp = hash32(dinfo, count * sizeof(tile_draw_info));
+    if (const dolls_data *doll = entry->doll())
+        fp ^= hash32(doll->parts, TILEP_PART_MAX * sizeof(tileidx_t));
+    if (entry->transparent())
+        fp = ~fp;
+    return fp;
+}
+
+static bool _entries_match(const mcache_entry *a, const mcache_entry *b)
+{
+    tile_draw_info da[mcache_entry::MAX_INFO_COUNT];
+    tile_draw_info db[mcache_entry::MAX_INFO_COUNT];
+    const int ca = a->info(da);
+    if (ca != b->info(db))
+        return false;
+
+    for (int i = 0; i < ca; i++)
+    {
+        if (da[i].idx != db[i].idx
+            || da[i].ofs_x != db[i].ofs_x
+            || da[i].ofs_y != db[i].ofs_y)
+        {
+            return false;
+        }
+    }
+
+    const dolls_data *doll_a = a->doll();
+    const dolls_data *doll_b = b->doll();
+    if (!doll_a != !doll_b || doll_a && *doll_a != *doll_b)
+        return false;
+
+    return a->transparent() == b->transparent();
+}
+
+static void _index_erase(map<uint32_t, vector<unsigned int>> &index,
+                         uint32_t fingerprint, unsigned int slot)
+{
+    auto it = index.find(fingerprint);
+    if (it == index.end())
+        return;
+
+    vector<unsigned int> &slots = it->second;
+    slots.erase(remove(slots.begin(), slots.end(), slot), slots.end());
+    if (slots.empty())
+        index.erase(it);
+}
+
 unsigned int mcache_manager::register_monster(const monster_info& minf)
 {
-    // TODO enne - is it worth it to search against all mcache entries?
     // TODO enne - pool mcache types to avoid too much alloc/dealloc?
 
     mcache_entry *entry;
@@ -180,42 +234,64 @@ unsigned int mcache_manager::register_monster(const monster_info& minf)
     else
         return 0;
 
-    tileidx_t idx = ~0;
-
-    for (unsigned int i = 0; i < m_entries.size(); i++)
+    // Reuse an existing entry that renders identically, if any; this
+    // is the common case, as every cell update re-registers the
+    // monster it displays. The backstore's ref counts keep the shared
+    // entry alive.
+    const uint32_t fingerprint = _entry_fingerprint(entry);
+    auto it = m_index.find(fingerprint);
+    if (it != m_index.end())
     {
-        if (!m_entries[i])
+        for (unsigned int slot : it->second)
         {
-            m_entries[i] = entry;
-            idx = i;
-            break;
+            if (_entries_match(m_entries[slot], entry))
+            {
+                delete entry;
+                return TILEP_MCACHE_START + slot;
+            }
         }
     }
 
-    if (idx > m_entries.size())
+    unsigned int idx;
+    if (!m_free_slots.empty())
+    {
+        idx = m_free_slots.back();
+        m_free_slots.pop_back();
+        m_entries[idx] = entry;
+        m_fingerprints[idx] = fingerprint;
+    }
+    else
     {
         idx = m_entries.size();
         m_entries.push_back(entry);
+        m_fingerprints.push_back(fingerprint);
     }
+    m_index[fingerprint].push_back(idx);
 
     return TILEP_MCACHE_START + idx;
 }
 
 void mcache_manager::clear_nonref()
 {
-    for (mcache_entry *&entry : m_entries)
+    for (unsigned int i = 0; i < m_entries.size(); i++)
     {
+        mcache_entry *entry = m_entries[i];
         if (!entry || entry->ref_count() > 0)
             continue;
 
+        _index_erase(m_index, m_fingerprints[i], i);
         delete entry;
-        entry = nullptr;
+        m_entries[i] = nullptr;
+        m_free_slots.push_back(i);
     }
 }
 
 void mcache_manager::clear_all()
 {
     deleteAll(m_entries);
+    m_free_slots.clear();
+    m_fingerprints.clear();
+    m_index.clear();
 }
 
 mcache_entry *mcache_manager::get(tileidx_t tile)
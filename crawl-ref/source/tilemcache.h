@@ -7,6 +7,7 @@
 #ifndef TILEMCACHE_H
 #define TILEMCACHE_H
 
+#include <map>
 #include <vector>
 
 struct dolls_data;
@@ -75,6 +76,13 @@ public:
 
 protected:
     vector<mcache_entry*> m_entries;
+    // Slots in m_entries freed by clear_nonref, available for reuse.
+    vector<unsigned int> m_free_slots;
+    // Rendering fingerprint of each occupied slot, and a fingerprint
+    // to slots index so register_monster can find an existing entry
+    // that renders identically instead of allocating a duplicate.
+    vector<uint32_t> m_fingerprints;
+    map<uint32_t, vector<unsigned int>> m_index;
 };
 
 // The global monster cache.
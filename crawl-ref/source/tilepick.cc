@@ -143,7 +143,11 @@ static tileidx_t _tileidx_shop(coord_def where)
     }
 }
 
-tileidx_t tileidx_feature_base(dungeon_feature_type feat)
+// The full feature -> base tile mapping, used once to fill the dense
+// table below. Context-dependent features (trees, hell and vestibule
+// entries, the Vaults and Zot gates) are intercepted before the table
+// is consulted, so their entries here are never used.
+static tileidx_t _tileidx_feature_base_static(dungeon_feature_type feat)
 {
     switch (feat)
     {
@@ -177,8 +181,6 @@ tileidx_t tileidx_feature_base(dungeon_feature_type feat)
         return TILE_DNGN_CRYSTAL_WALL;
     case DNGN_ORCISH_IDOL:
         return TILE_DNGN_ORCISH_IDOL;
-    case DNGN_TREE:
-        return player_in_branch(BRANCH_SWAMP) ? TILE_DNGN_MANGROVE : TILE_DNGN_TREE;
     case DNGN_GRANITE_STATUE:
         return TILE_DNGN_GRANITE_STATUE;
     case DNGN_LAVA:
@@ -196,10 +198,6 @@ tileidx_t tileidx_feature_base(dungeon_feature_type feat)
         return TILE_FLOOR_NORMAL;
     case DNGN_ENDLESS_SALT:
         return TILE_DNGN_ENDLESS_SALT;
-    case DNGN_ENTER_HELL:
-        if (player_in_hell())
-            return TILE_DNGN_RETURN_VESTIBULE;
-        return TILE_DNGN_ENTER_HELL;
     case DNGN_OPEN_DOOR:
         return TILE_DNGN_OPEN_DOOR;
     case DNGN_TRAP_MECHANICAL:
@@ -258,10 +256,6 @@ tileidx_t tileidx_feature_base(dungeon_feature_type feat)
         return TILE_DNGN_RETURN_HELL;
     case DNGN_EXIT_ABYSS:
         return TILE_DNGN_EXIT_ABYSS;
-    case DNGN_STONE_ARCH:
-        if (player_in_branch(BRANCH_VESTIBULE))
-            return TILE_DNGN_STONE_ARCH_HELL;
-        return TILE_DNGN_STONE_ARCH;
     case DNGN_ENTER_PANDEMONIUM:
         return TILE_DNGN_ENTER_PANDEMONIUM;
     case DNGN_TRANSIT_PANDEMONIUM:
@@ -296,16 +290,10 @@ tileidx_t tileidx_feature_base(dungeon_feature_type feat)
         return TILE_DNGN_ENTER_SLIME;
     case DNGN_ENTER_DEPTHS:
         return TILE_DNGN_ENTER_DEPTHS;
-    case DNGN_ENTER_VAULTS:
-        return is_existing_level(level_id(BRANCH_VAULTS, 1)) ? TILE_DNGN_ENTER_VAULTS_OPEN
-                              : TILE_DNGN_ENTER_VAULTS_CLOSED;
     case DNGN_ENTER_CRYPT:
         return TILE_DNGN_ENTER_CRYPT;
     case DNGN_ENTER_TOMB:
         return TILE_DNGN_ENTER_TOMB;
-    case DNGN_ENTER_ZOT:
-        return is_existing_level(level_id(BRANCH_ZOT, 1)) ? TILE_DNGN_ENTER_ZOT_OPEN
-                              : TILE_DNGN_ENTER_ZOT_CLOSED;
     case DNGN_ENTER_ZIGGURAT:
         return TILE_DNGN_PORTAL_ZIGGURAT;
     case DNGN_ENTER_BAZAAR:
@@ -460,6 +448,57 @@ tileidx_t tileidx_feature_base(dungeon_feature_type feat)
     }
 }
 
+// Dense feature -> base tile table. tileidx_feature_base() is a leaf
+// under viewwindow's per-cell redraw work, and the switch above is a
+// long branch chain; one array read per cell is much kinder to the
+// branch predictor.
+static tileidx_t _feature_base_tile[NUM_FEATURES];
+static bool _feature_base_tile_init = false;
+
+tileidx_t tileidx_feature_base(dungeon_feature_type feat)
+{
+    // The few features whose base tile depends on where the player is
+    // or on which levels exist.
+    switch (feat)
+    {
+    case DNGN_TREE:
+        return player_in_branch(BRANCH_SWAMP) ? TILE_DNGN_MANGROVE
+                                              : TILE_DNGN_TREE;
+    case DNGN_ENTER_HELL:
+        if (player_in_hell())
+            return TILE_DNGN_RETURN_VESTIBULE;
+        return TILE_DNGN_ENTER_HELL;
+    case DNGN_STONE_ARCH:
+        if (player_in_branch(BRANCH_VESTIBULE))
+            return TILE_DNGN_STONE_ARCH_HELL;
+        return TILE_DNGN_STONE_ARCH;
+    case DNGN_ENTER_VAULTS:
+        return is_existing_level(level_id(BRANCH_VAULTS, 1))
+               ? TILE_DNGN_ENTER_VAULTS_OPEN
+               : TILE_DNGN_ENTER_VAULTS_CLOSED;
+    case DNGN_ENTER_ZOT:
+        return is_existing_level(level_id(BRANCH_ZOT, 1))
+               ? TILE_DNGN_ENTER_ZOT_OPEN
+               : TILE_DNGN_ENTER_ZOT_CLOSED;
+    default:
+        break;
+    }
+
+    if (!_feature_base_tile_init)
+    {
+        for (int i = 0; i < NUM_FEATURES; ++i)
+        {
+            _feature_base_tile[i] = _tileidx_feature_base_static(
+                static_cast<dungeon_feature_type>(i));
+        }
+        _feature_base_tile_init = true;
+    }
+
+    if (feat < 0 || feat >= NUM_FEATURES)
+        return TILE_DNGN_ERROR;
+    return _feature_base_tile[feat];
+}
+
 bool is_door_tile(tileidx_t tile)
 {
     return tile >= TILE_DNGN_CLOSED_DOOR &&
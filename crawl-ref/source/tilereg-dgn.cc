@@ -78,10 +78,19 @@ DungeonRegion::~DungeonRegion()
 void DungeonRegion::load_dungeon(const crawl_view_buffer &vbuf,
                                  const coord_def &gc)
 {
+    const int cx_to_gx = gc.x - mx / 2;
+    const int cy_to_gy = gc.y - my / 2;
+
+    // viewwindow pushes a fresh vbuf for every message and status
+    // refresh, most of which change nothing in the viewport; keep the
+    // packed vertex buffers if this one renders identically.
+    if (cx_to_gx == m_cx_to_gx && cy_to_gy == m_cy_to_gy && m_vbuf == vbuf)
+        return;
+
     m_dirty = true;
 
-    m_cx_to_gx = gc.x - mx / 2;
-    m_cy_to_gy = gc.y - my / 2;
+    m_cx_to_gx = cx_to_gx;
+    m_cy_to_gy = cy_to_gy;
 
     m_vbuf = vbuf;
 
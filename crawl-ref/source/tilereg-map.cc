@@ -65,6 +65,8 @@ void MapRegion::init_colours()
     m_colours[MF_EXCL_ROOT]     = Options.tile_excl_centre_col;
     m_colours[MF_EXCL]          = Options.tile_excluded_col;
     m_colours[MF_PLAYER]        = Options.tile_player_col;
+
+    m_dirty = true;
 }
 
 MapRegion::~MapRegion()
@@ -77,15 +79,29 @@ void MapRegion::pack_buffers()
     m_buf_map.clear();
     m_buf_lines.clear();
 
-    for (int x = m_min_gx; x <= m_max_gx; x++)
-        for (int y = m_min_gy; y <= m_max_gy; y++)
+    for (int y = m_min_gy; y <= m_max_gy; y++)
+    {
+        // Runs of the same feature become a single quad; most rows are
+        // long stretches of wall, floor or unseen cells.
+        int x = m_min_gx;
+        while (x <= m_max_gx)
         {
             map_feature f = (map_feature)m_buf[x + y * mx];
 
+            int run_end = x + 1;
+            while (run_end <= m_max_gx
+                   && (map_feature)m_buf[run_end + y * mx] == f)
+            {
+                run_end++;
+            }
+
             float pos_x = x - m_min_gx;
             float pos_y = y - m_min_gy;
-            m_buf_map.add(pos_x, pos_y, pos_x + 1, pos_y + 1, m_colours[f]);
+            m_buf_map.add(pos_x, pos_y, run_end - m_min_gx, pos_y + 1,
+                          m_colours[f]);
+            x = run_end;
         }
+    }
 
     // Draw window box.
     if (m_win_start.x == -1 && m_win_end.x == -1)
@@ -129,18 +145,26 @@ void MapRegion::recenter()
 void MapRegion::set(const coord_def &gc, map_feature f)
 {
     ASSERT((unsigned int)f <= (unsigned char)~0);
-    m_buf[gc.x + gc.y * mx] = f;
+    unsigned char &cell = m_buf[gc.x + gc.y * mx];
+    if (cell == (unsigned char)f)
+        return;
+    cell = f;
+    m_dirty = true;
 
     if (f == MF_UNSEEN)
         return;
 
     // Get map extents
-    m_min_gx = min(m_min_gx, gc.x);
-    m_max_gx = max(m_max_gx, gc.x);
-    m_min_gy = min(m_min_gy, gc.y);
-    m_max_gy = max(m_max_gy, gc.y);
+    if (gc.x < m_min_gx || gc.x > m_max_gx
+        || gc.y < m_min_gy || gc.y > m_max_gy)
+    {
+        m_min_gx = min(m_min_gx, gc.x);
+        m_max_gx = max(m_max_gx, gc.x);
+        m_min_gy = min(m_min_gy, gc.y);
+        m_max_gy = max(m_max_gy, gc.y);
 
-    recenter();
+        recenter();
+    }
 }
 
 void MapRegion::update_bounds()
@@ -169,14 +193,20 @@ void MapRegion::update_bounds()
         }
 
     recenter();
-#if 0
-    // Not needed? (jpeg)
-    m_dirty = true;
-#endif
+
+    // The packed quads are positioned relative to the map extents.
+    if (m_min_gx != min_gx || m_max_gx != max_gx
+        || m_min_gy != min_gy || m_max_gy != max_gy)
+    {
+        m_dirty = true;
+    }
 }
 
 void MapRegion::set_window(const coord_def &start, const coord_def &end)
 {
+    if (start == m_win_start && end == m_win_end)
+        return;
+
     m_win_start = start;
     m_win_end   = end;
 
@@ -36,9 +36,8 @@ void MonsterRegion::update()
     if (max_mons == 0)
         return;
 
+    // get_monster_info() returns the list already sorted.
     get_monster_info(m_mon_info);
-    sort(m_mon_info.begin(), m_mon_info.end(),
-              monster_info::less_than_wrapper);
 
     unsigned int num_mons = min(max_mons, m_mon_info.size());
     for (size_t i = 0; i < num_mons; ++i)
@@ -22,7 +22,11 @@ TextRegion::TextRegion(FontWrapper *font) :
     abuf(nullptr),
     cx_ofs(0),
     cy_ofs(0),
-    m_font(font)
+    m_font(font),
+    m_cachebuf(nullptr),
+    m_cache_dirty(true),
+    m_cacheable(false),
+    m_cache_gen(0)
 {
     ASSERT(font);
 
@@ -30,6 +34,11 @@ TextRegion::TextRegion(FontWrapper *font) :
     dy = m_font->char_height();
 }
 
+void TextRegion::invalidate_cache()
+{
+    m_cache_dirty = true;
+}
+
 void TextRegion::on_resize()
 {
     delete[] cbuf;
@@ -44,12 +53,15 @@ void TextRegion::on_resize()
         cbuf[i] = ' ';
         abuf[i] = 0;
     }
+
+    invalidate_cache();
 }
 
 TextRegion::~TextRegion()
 {
     delete[] cbuf;
     delete[] abuf;
+    delete m_cachebuf;
 }
 
 void TextRegion::adjust_region(int *x1, int *x2, int y)
@@ -120,6 +132,7 @@ void TextRegion::addstr_aux(const ucs_t *buffer, int len)
         abuf[adrs+x+i] = text_col;
     }
     print_x += len;
+    invalidate_cache();
 }
 
 void TextRegion::clear_to_end_of_line()
@@ -135,6 +148,7 @@ void TextRegion::clear_to_end_of_line()
         cbuf[adrs+i] = ' ';
         abuf[adrs+i] = col;
     }
+    invalidate_cache();
 }
 
 void TextRegion::putwch(ucs_t ch)
@@ -226,7 +240,27 @@ void TextRegion::render()
         abuf[idx] = col_back;
     }
     else
-        m_font->render_textblock(sx + ox, sy + oy, cbuf, abuf, mx, my);
+    {
+        // The packed quads can be reused across frames as long as the
+        // text and the font's glyph atlas are unchanged, which is the
+        // common case: a redraw re-renders every region even when only
+        // one of them changed.
+        if (!m_cachebuf)
+            m_cachebuf = GLShapeBuffer::create(true, true);
+
+        if (m_cache_dirty || m_cache_gen != m_font->atlas_generation())
+        {
+            m_cacheable = m_font->pack_textblock(*m_cachebuf, cbuf, abuf,
+                                                 mx, my);
+            m_cache_gen = m_font->atlas_generation();
+            m_cache_dirty = false;
+        }
+
+        if (m_cacheable)
+            m_font->draw_textblock_buffer(*m_cachebuf, sx + ox, sy + oy);
+        else
+            m_font->render_textblock(sx + ox, sy + oy, cbuf, abuf, mx, my);
+    }
 }
 
 void TextRegion::clear()
@@ -236,6 +270,7 @@ void TextRegion::clear()
         cbuf[i] = ' ';
         abuf[i] = 0;
     }
+    invalidate_cache();
 }
 
 void TextRegion::scroll()
@@ -256,6 +291,7 @@ void TextRegion::scroll()
         print_y -= 1;
     if (cursor_y > 0)
         cursor_y -= 1;
+    invalidate_cache();
 }
 
 #endif
@@ -4,6 +4,8 @@
 
 #include "tilereg.h"
 
+class GLShapeBuffer;
+
 class TextRegion : public Region
 {
 public:
@@ -54,7 +56,17 @@ public:
 
 protected:
     virtual void on_resize() override;
+    void invalidate_cache();
+
     FontWrapper *m_font;
+
+    // Quads packed from the current cbuf/abuf contents, reused across
+    // frames: every redraw re-renders all regions, but a region's text
+    // rarely changes between frames.
+    GLShapeBuffer *m_cachebuf;
+    bool m_cache_dirty;
+    bool m_cacheable;
+    unsigned int m_cache_gen;
 };
 
 #endif
@@ -641,6 +641,13 @@ int TilesFramework::getch_ck()
 
     const unsigned int ticks_per_screen_redraw = Options.tile_update_rate;
 
+    // The periodic idle redraw below exists only to advance the water
+    // and portal tile animations; each one re-renders every region and
+    // blocks in swap_buffers() until vsync. With the animations turned
+    // off, render only when something actually changed.
+    const bool tile_animations = Options.tile_water_anim
+                                 || Options.tile_misc_anim;
+
     unsigned int res = Options.tile_tooltip_ms;
     unsigned int timer_id = wm->set_timer(res, &_timer_callback);
 
@@ -850,7 +857,8 @@ int TilesFramework::getch_ck()
             }
 
             if (need_redraw()
-                || ticks > m_last_tick_redraw
+                || tile_animations
+                   && ticks > m_last_tick_redraw
                    && ticks - m_last_tick_redraw > ticks_per_screen_redraw)
             {
                 redraw();
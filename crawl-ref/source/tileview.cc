@@ -390,16 +390,34 @@ static int _find_variants(tileidx_t idx, int variant, map<tileidx_t, int> &out)
     return total;
 }
 
+// The weight tables _find_variants builds depend only on the static
+// tile data, but pick_dngn_tile is called for every cell of the grid
+// on level init. Memoize them per (idx, domino).
+struct tile_variants
+{
+    int total;
+    map<tileidx_t, int> weights;
+};
+
 tileidx_t pick_dngn_tile(tileidx_t idx, int value, int domino)
 {
     ASSERT_LESS(idx, TILE_DNGN_MAX);
-    map<tileidx_t, int> choices;
-    int total = _find_variants(idx, domino, choices);
-    if (choices.size() == 1)
-        return choices.begin()->first;
-    int rand  = value % total;
+    static map<pair<tileidx_t, int>, tile_variants> cache;
+
+    auto it = cache.find(make_pair(idx, domino));
+    if (it == cache.end())
+    {
+        tile_variants v;
+        v.total = _find_variants(idx, domino, v.weights);
+        it = cache.insert(make_pair(make_pair(idx, domino), v)).first;
+    }
+
+    const tile_variants &variants = it->second;
+    if (variants.weights.size() == 1)
+        return variants.weights.begin()->first;
+    int rand = value % variants.total;
 
-    for (const auto& elem : choices)
+    for (const auto& elem : variants.weights)
     {
         rand -= elem.second;
         if (rand < 0)
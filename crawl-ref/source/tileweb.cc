@@ -68,6 +68,7 @@ TilesFramework tiles;
 TilesFramework::TilesFramework()
     : m_crt_mode(CRT_NORMAL),
       m_controlled_from_web(false),
+      m_recording_snapshot(false),
       m_last_ui_state(UI_INIT),
       m_view_loaded(false),
       m_next_view_tl(0, 0),
@@ -180,8 +181,42 @@ void TilesFramework::finish_message()
     }
 
     m_msg_buf.append("\n");
-    const char* fragment_start = m_msg_buf.data();
-    const char* data_end = m_msg_buf.data() + m_msg_buf.size();
+
+    // Any state broadcast makes the spectator-join snapshot stale;
+    // messages addressed to the server itself (prefixed '*') don't
+    // change what a new watcher needs to see.
+    if (m_recording_snapshot)
+        m_state_snapshot += m_msg_buf;
+    else if (m_msg_buf[0] != '*')
+        m_state_snapshot.clear();
+
+    // Batch finished messages; they go out together the next time we
+    // wait for input. Messages addressed to the server may be acted on
+    // without any client input, so those (and whatever is queued ahead
+    // of them) go right away, and the size cap keeps a message storm
+    // (e.g. a full map send) from buffering without bound.
+    const bool server_msg = m_msg_buf[0] == '*';
+    m_send_buf += m_msg_buf;
+    m_msg_buf.clear();
+    if (server_msg || m_send_buf.size() >= 1024 * 1024)
+        _flush_send_buffer();
+}
+
+void TilesFramework::_flush_send_buffer()
+{
+    if (m_send_buf.empty())
+        return;
+
+    _send_raw(m_send_buf);
+    m_send_buf.clear();
+}
+
+// Push a block of already-serialized messages out to all attached
+// receivers, fragmenting as needed.
+void TilesFramework::_send_raw(const string &data)
+{
+    const char* fragment_start = data.data();
+    const char* data_end = data.data() + data.size();
     while (fragment_start < data_end)
     {
         int fragment_size = data_end - fragment_start;
@@ -228,7 +263,6 @@ void TilesFramework::finish_message()
 
         fragment_start += fragment_size;
     }
-    m_msg_buf.clear();
     m_need_flush = true;
 }
 
@@ -261,6 +295,7 @@ void TilesFramework::flush_messages()
         send_message("*{\"msg\":\"flush_messages\"}");
         m_need_flush = false;
     }
+    _flush_send_buffer();
 }
 
 void TilesFramework::_await_connection()
@@ -331,7 +366,20 @@ wint_t TilesFramework::_handle_control_message(sockaddr_un addr, string data)
     else if (msgtype == "spectator_joined")
     {
         flush_messages();
-        _send_everything();
+        if (!m_state_snapshot.empty())
+        {
+            // Nothing has been broadcast since the last full send, so
+            // replay the recorded snapshot rather than serializing the
+            // whole game state again. Tournament join waves hit this
+            // for every watcher after the first.
+            _send_raw(m_state_snapshot);
+        }
+        else
+        {
+            m_recording_snapshot = true;
+            _send_everything();
+            m_recording_snapshot = false;
+        }
         flush_messages();
     }
     else if (msgtype == "menu_scroll")
@@ -404,10 +452,33 @@ bool TilesFramework::await_input(wint_t& c, bool block)
             if (block)
             {
                 tiles.flush_messages();
-                result = select(maxfd + 1, &fds, nullptr, nullptr, nullptr);
+
+                // Waiting for a command with idle saving configured:
+                // bound the wait, and put the game to sleep through the
+                // regular save machinery if nothing arrives in time.
+                // Menus and prompts (other mouse modes) wait forever as
+                // before, since saving there would lose interface state.
+                timeval idle_timeout;
+                timeval *timeoutp = nullptr;
+                if (Options.tile_web_idle_save_time > 0
+                    && crawl_state.need_save
+                    && !crawl_state.game_is_arena()
+                    && mouse_control::current_mode() == MOUSE_MODE_COMMAND)
+                {
+                    idle_timeout.tv_sec  = Options.tile_web_idle_save_time;
+                    idle_timeout.tv_usec = 0;
+                    timeoutp = &idle_timeout;
+                }
+
+                result = select(maxfd + 1, &fds, nullptr, nullptr, timeoutp);
+
+                if (result == 0 && timeoutp)
+                    save_game(true, "Saved the game after idle time.");
             }
             else
             {
+                _flush_send_buffer();
+
                 timeval timeout;
                 timeout.tv_sec = 0;
                 timeout.tv_usec = 0;
@@ -1416,6 +1487,8 @@ void TilesFramework::_send_map(bool force_full)
     coord_def last_gc(0, 0);
     bool send_gc = true;
 
+    vector<coord_def> cells_sent;
+
     json_open_array("cells");
     for (int y = 0; y < GYM; y++)
         for (int x = 0; x < GXM; x++)
@@ -1435,6 +1508,7 @@ void TilesFramework::_send_map(bool force_full)
             }
 
             mark_clean(gc);
+            cells_sent.push_back(gc);
 
             if (m_origin.equals(-1, -1))
                 m_origin = gc;
@@ -1478,7 +1552,19 @@ void TilesFramework::_send_map(bool force_full)
     if (m_mcache_ref_done)
         _mcache_ref(false);
 
-    m_current_map_knowledge = env.map_knowledge;
+    // Resync the diffing baseline. Cells that weren't sent this time are
+    // unchanged since the last update (anything that modifies a cell's map
+    // knowledge marks it dirty), so only the sent cells need their map_cell
+    // deep-copied. Deferred until after the send loop: _send_monster diffs
+    // against the baseline at a monster's *previous* location, which may be
+    // a cell processed earlier in the same loop.
+    if (force_full)
+        m_current_map_knowledge = env.map_knowledge;
+    else
+    {
+        for (const coord_def &gc : cells_sent)
+            m_current_map_knowledge(gc) = env.map_knowledge(gc);
+    }
     m_current_view = m_next_view;
 
     _mcache_ref(true);
@@ -1980,21 +2066,29 @@ void TilesFramework::write_message_escaped(const string& s)
 {
     m_msg_buf.reserve(m_msg_buf.size() + s.size());
 
-    for (unsigned char c : s)
+    // Most strings need no escaping at all; copy runs of clean
+    // characters in one append each rather than one at a time.
+    size_t start = 0;
+    for (size_t i = 0; i < s.size(); ++i)
     {
+        const unsigned char c = s[i];
+        if (c != '"' && c != '\\' && c >= 0x20)
+            continue;
+
+        m_msg_buf.append(s, start, i - start);
         if (c == '"')
             m_msg_buf.append("\\\"");
         else if (c == '\\')
             m_msg_buf.append("\\\\");
-        else if (c < 0x20)
+        else
         {
             char buf[7];
             snprintf(buf, sizeof(buf), "\\u%04x", c);
             m_msg_buf.append(buf);
         }
-        else
-            m_msg_buf.append(1, c);
+        start = i + 1;
     }
+    m_msg_buf.append(s, start, s.size() - start);
 }
 
 void TilesFramework::json_open(const string& name, char opener, char type)
@@ -2074,16 +2168,16 @@ void TilesFramework::json_write_comma()
     if (m_msg_buf.empty()) return;
     char last = m_msg_buf[m_msg_buf.size() - 1];
     if (last == '{' || last == '[' || last == ',' || last == ':') return;
-    write_message(",");
+    m_msg_buf.append(1, ',');
 }
 
 void TilesFramework::json_write_name(const string& name)
 {
     json_write_comma();
 
-    write_message("\"");
+    m_msg_buf.append(1, '"');
     write_message_escaped(name);
-    write_message("\":");
+    m_msg_buf.append("\":");
 }
 
 void TilesFramework::json_write_int(int value)
@@ -2105,10 +2199,7 @@ void TilesFramework::json_write_bool(bool value)
 {
     json_write_comma();
 
-    if (value)
-        write_message("true");
-    else
-        write_message("false");
+    m_msg_buf.append(value ? "true" : "false");
 }
 
 void TilesFramework::json_write_bool(const string& name, bool value)
@@ -2123,7 +2214,7 @@ void TilesFramework::json_write_null()
 {
     json_write_comma();
 
-    write_message("null");
+    m_msg_buf.append("null");
 }
 
 void TilesFramework::json_write_null(const string& name)
@@ -212,6 +212,20 @@ protected:
     bool m_controlled_from_web;
     bool m_need_flush;
 
+    // Serialized full game state from the last spectator join, replayed
+    // verbatim for further joins until some state broadcast invalidates
+    // it. Join waves then serialize the game once, not once per watcher.
+    string m_state_snapshot;
+    bool m_recording_snapshot;
+
+    // Finished messages accumulate here and go out in one batched
+    // write when input is next awaited (or when the buffer gets big),
+    // instead of one send per message.
+    string m_send_buf;
+
+    void _send_raw(const string &data);
+    void _flush_send_buffer();
+
     void _await_connection();
     wint_t _handle_control_message(sockaddr_un addr, string data);
     wint_t _receive_control_message();
@@ -1609,6 +1609,10 @@ int count_malign_gateways()
 
 void timeout_malign_gateways(int duration)
 {
+    // Nothing to expire on the overwhelming majority of turns.
+    if (!env.markers.have_any(MAT_MALIGN))
+        return;
+
     // Passing 0 should allow us to just touch the gateway and see
     // if it should decay. This, in theory, should resolve the one
     // turn delay between it timing out and being recastable. -due
@@ -1668,7 +1672,7 @@ void timeout_malign_gateways(int duration)
 
 void timeout_tombs(int duration)
 {
-    if (!duration)
+    if (!duration || !env.markers.have_any(MAT_TOMB))
         return;
 
     for (map_marker *mark : env.markers.get_all(MAT_TOMB))
@@ -1705,7 +1709,7 @@ void timeout_tombs(int duration)
 
 void timeout_terrain_changes(int duration, bool force)
 {
-    if (!duration && !force)
+    if (!duration && !force || !env.markers.have_any(MAT_TERRAIN_CHANGE))
         return;
 
     int num_seen[NUM_TERRAIN_CHANGE_TYPES] = {0};
@@ -1904,6 +1904,7 @@ bool transform(int pow, transformation_type which_trans, bool involuntary,
             ASSERT(app != NUM_MUTATIONS);
             ASSERT(beastly_slot(app) != EQ_NONE);
             you.mutation[app] = _beastly_appendage_level(app);
+            invalidate_mutation_cache();
         }
         break;
 
@@ -2018,6 +2019,7 @@ void untransform(bool skip_move)
         const int extra = max(0, levels - you.innate_mutation[app]
                                         - beast_levels);
         you.mutation[app] = you.innate_mutation[app] + extra;
+        invalidate_mutation_cache();
         you.attribute[ATTR_APPENDAGE] = 0;
 
         // The mutation might have been removed already by a conflicting
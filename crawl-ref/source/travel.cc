@@ -111,6 +111,39 @@ static string trans_travel_dest;
 // hostile terrain.
 travel_distance_grid_t travel_point_distance;
 
+// Cache of the last plain (no travel move, no feature annotation)
+// floodout of travel_point_distance. Stash search ranking and
+// interlevel planning reflood from the same source many times per
+// command; replaying the cached field is far cheaper than reflooding.
+static travel_distance_grid_t _tpd_cache;
+static coord_def _tpd_cache_src(-1, -1);
+static level_id _tpd_cache_level;
+static bool _tpd_cache_valid = false;
+
+// Remainder of the path computed by the last stepping pathfind, so
+// subsequent travel/explore steps towards an unchanged target can
+// replay it instead of re-flooding the level. back() is the next square
+// to move to; every replayed square is re-validated first, so the cache
+// never forces an unsafe step.
+static vector<coord_def> _travel_path_cache;
+static coord_def _travel_path_dest(-1, -1);
+static level_id _travel_path_level;
+
+// Anything that can change travel distances (terrain, excludes,
+// monsters and clouds moving with the world) must call this.
+void invalidate_travel_distance_cache()
+{
+    _tpd_cache_valid = false;
+}
+
+// Terrain changed somewhere on the current level; the stored
+// stair-to-stair distances may no longer be correct.
+void travel_stair_distances_dirty()
+{
+    if (LevelInfo *li = travel_cache.find_level_info(level_id::current()))
+        li->mark_stair_distances_dirty();
+}
+
 // Apply slime wall checks when checking if squares are travelsafe.
 bool g_Slime_Wall_Check = true;
 
@@ -123,6 +156,27 @@ static bool ignore_player_traversability = false;
 // Map of terrain types that are forbidden.
 static FixedVector<int8_t,NUM_FEATURES> forbidden_terrain;
 
+// Per-feature memo of feat_is_traversable_now(), filled lazily during a
+// single pathfind: the flood visits thousands of cells but only a few
+// dozen distinct feature types, and the player state the check reads
+// (flight, swimming, door-opening forms) can't change mid-search.
+// Flushed at the top of each pathfind; -1 marks unknown entries.
+static int8_t _traversable_now_cache[2][NUM_FEATURES];
+
+static void _flush_traversable_now_cache()
+{
+    memset(_traversable_now_cache, -1, sizeof(_traversable_now_cache));
+}
+
+static bool _feat_is_traversable_now_cached(dungeon_feature_type grid,
+                                            bool try_fallback)
+{
+    int8_t &entry = _traversable_now_cache[try_fallback][grid];
+    if (entry == -1)
+        entry = feat_is_traversable_now(grid, try_fallback);
+    return entry;
+}
+
 /*
  * Warn if interlevel travel is going to take you outside levels in
  * the range [src,dest].
@@ -460,7 +514,7 @@ static bool _is_travelsafe_square(const coord_def& c, bool ignore_hostile,
     if (levelmap_cell.feat() == DNGN_RUNED_DOOR && !try_fallback)
         return false;
 
-    return feat_is_traversable_now(grid, try_fallback);
+    return _feat_is_traversable_now_cached(grid, try_fallback);
 }
 
 // Returns true if the location at (x,y) is monster-free and contains
@@ -631,17 +685,24 @@ void stop_running(bool clear_delays)
 
 static bool _is_valid_explore_target(const coord_def& where)
 {
-    // If a square in LOS is unmapped, it's valid.
-    for (radius_iterator ri(where, LOS_DEFAULT, true); ri; ++ri)
-        if (!env.map_knowledge(*ri).seen())
-            return true;
+    // This runs on every step of an explore run to decide whether the
+    // current target still warrants walking to; only when it says no do
+    // we pay for a new level-wide floodfill.
 
+    // A greedy target is usually an item or shop, which is a couple of
+    // hash probes to check - much cheaper than scanning its LOS disc.
     if (you.running == RMODE_EXPLORE_GREEDY)
     {
         LevelStashes *lev = StashTrack.find_current_level();
-        return lev && lev->needs_visit(where, can_autopickup());
+        if (lev && lev->needs_visit(where, can_autopickup()))
+            return true;
     }
 
+    // If a square in LOS is unmapped, it's valid.
+    for (radius_iterator ri(where, LOS_DEFAULT, true); ri; ++ri)
+        if (!env.map_knowledge(*ri).seen())
+            return true;
+
     return false;
 }
 
@@ -779,7 +840,7 @@ static void _explore_find_target_square()
                 feature = grd(target);
             }
             while (_is_travelsafe_square(target, fallback)
-                   && feat_is_traversable_now(feature, fallback)
+                   && _feat_is_traversable_now_cached(feature, fallback)
                    && _feature_traverse_cost(feature) == 1);
 
             target -= delta;
@@ -1256,6 +1317,10 @@ coord_def travel_pathfind::pathfind(run_mode_type rmode, bool fallback_explore)
         }
     }
 
+    // ignore_player_traversability is now set for this search; any
+    // entries left over from a previous one may not match it.
+    _flush_traversable_now_cache();
+
     if (!ls && (annotate_map || need_for_greed))
         ls = StashTrack.find_current_level();
 
@@ -1741,25 +1806,134 @@ bool travel_pathfind::path_examine_point(const coord_def &c)
 
 // Try to avoid to let travel (including autoexplore) move the player right
 // next to a lurking (previously unseen) monster.
+// Rebuild the cached path by walking the distance grid the stepping
+// pathfind just filled in (distances decrease towards the target).
+// first is the square being stepped onto right now, so the stored path
+// starts with the square after it and ends on the target.
+static void _rebuild_travel_path_cache(const coord_def &first)
+{
+    _travel_path_cache.clear();
+    _travel_path_dest = you.running.pos;
+    _travel_path_level = level_id::current();
+
+    const coord_def target = you.running.pos;
+    if (first.origin() || first == target || !in_bounds(first))
+        return;
+
+    vector<coord_def> path;
+    coord_def c = first;
+    int dist = travel_point_distance[first.x][first.y];
+    while (c != target && dist > 0)
+    {
+        coord_def next;
+        int best = dist;
+        for (int dir = 0; dir < 8; dir++)
+        {
+            const coord_def n = c + Compass[dir];
+            if (!in_bounds(n))
+                continue;
+            if (n == target)
+            {
+                next = n;
+                best = 0;
+                break;
+            }
+            const int d = travel_point_distance[n.x][n.y];
+            if (d > 0 && d < best)
+            {
+                next = n;
+                best = d;
+            }
+        }
+        // No strictly descending neighbour (e.g. the route runs through
+        // negative ignore_hostile distances): cache what we have and
+        // let the replay fall back to a recompute from there.
+        if (next.origin())
+            break;
+        path.push_back(next);
+        c = next;
+        dist = best;
+    }
+
+    _travel_path_cache.assign(path.rbegin(), path.rend());
+}
+
 void find_travel_pos(const coord_def& youpos,
                      int *move_x, int *move_y,
                      vector<coord_def>* features)
 {
-    travel_pathfind tp;
+    // A plain floodout just populates travel_point_distance; replay
+    // the cached field if it's still valid for this source.
+    const bool plain_flood = !move_x && !move_y && !features;
+    if (plain_flood
+        && _tpd_cache_valid
+        && _tpd_cache_src == youpos
+        && _tpd_cache_level == level_id::current())
+    {
+        memcpy(travel_point_distance, _tpd_cache,
+               sizeof(travel_distance_grid_t));
+        return;
+    }
 
-    if (move_x && move_y)
-        tp.set_src_dst(youpos, you.running.pos);
-    else
-        tp.set_floodseed(youpos);
+    const bool stepping = move_x && move_y;
+
+    coord_def dest;
+    bool replayed = false;
+
+    // Replay the remainder of the last computed path if we're still on
+    // it; re-flooding the level for every single step is what dominates
+    // long travel and explore runs. The next square is re-checked with
+    // the same safety tests the pathfinder applies, so changed map
+    // knowledge forces a recompute instead of a blind step.
+    if (stepping && !features
+        && _travel_path_level == level_id::current()
+        && _travel_path_dest == you.running.pos
+        && !_travel_path_cache.empty())
+    {
+        const coord_def next = _travel_path_cache.back();
+        if ((next - youpos).rdist() == 1
+            && _is_travelsafe_square(next)
+            && feat_is_traversable_now(env.map_knowledge(next).feat()))
+        {
+            _travel_path_cache.pop_back();
+            dest = next;
+            replayed = true;
+        }
+        else
+            _travel_path_cache.clear();
+    }
+
+    if (!replayed)
+    {
+        travel_pathfind tp;
+
+        if (stepping)
+            tp.set_src_dst(youpos, you.running.pos);
+        else
+            tp.set_floodseed(youpos);
+
+        tp.set_feature_vector(features);
+
+        run_mode_type rmode = stepping ? RMODE_TRAVEL
+                                       : RMODE_NOT_RUNNING;
 
-    tp.set_feature_vector(features);
+        dest = tp.pathfind(rmode, false);
+        if (dest.origin())
+            dest = tp.pathfind(rmode, true);
 
-    run_mode_type rmode = (move_x && move_y) ? RMODE_TRAVEL
-                                             : RMODE_NOT_RUNNING;
+        if (plain_flood)
+        {
+            memcpy(_tpd_cache, travel_point_distance,
+                   sizeof(travel_distance_grid_t));
+            _tpd_cache_src = youpos;
+            _tpd_cache_level = level_id::current();
+            _tpd_cache_valid = true;
+        }
+
+        if (stepping)
+            _rebuild_travel_path_cache(dest);
+    }
 
-    coord_def dest = tp.pathfind(rmode, false);
-    if (dest.origin())
-        dest = tp.pathfind(rmode, true);
     coord_def new_dest = dest;
 
     if (grd(dest) == DNGN_RUNED_DOOR)
@@ -1776,7 +1950,7 @@ void find_travel_pos(const coord_def& youpos,
     // ?#@      --> Pick x instead.
 
     // Only applies to diagonal moves.
-    if (rmode == RMODE_TRAVEL && *move_x != 0 && *move_y != 0)
+    if (stepping && *move_x != 0 && *move_y != 0)
     {
         coord_def unseen = coord_def();
         for (adjacent_iterator ai(dest); ai; ++ai)
@@ -3185,16 +3359,24 @@ void LevelInfo::update()
     get_stairs(stair_positions);
 
     // Make sure our stair list is correct.
-    correct_stair_list(stair_positions);
+    if (correct_stair_list(stair_positions))
+        distances_dirty = true;
 
     sync_all_branch_stairs();
 
-    // If the player isn't immune to slimy walls, precalculate
-    // neighbours of slimy walls now.
-    unwind_slime_wall_precomputer slime_wall_neighbours(
-        !actor_slime_wall_immune(&you));
-    precompute_travel_safety_grid travel_safety_calc;
-    update_stair_distances();
+    // The stair distance matrix is the expensive part (one floodfill
+    // per stair); only rebuild it if the stair list, the excludes or
+    // the terrain changed since it was last computed.
+    if (distances_dirty)
+    {
+        // If the player isn't immune to slimy walls, precalculate
+        // neighbours of slimy walls now.
+        unwind_slime_wall_precomputer slime_wall_neighbours(
+            !actor_slime_wall_immune(&you));
+        precompute_travel_safety_grid travel_safety_calc;
+        update_stair_distances();
+        distances_dirty = false;
+    }
 
     update_daction_counters(this);
 }
@@ -3289,6 +3471,7 @@ void LevelInfo::create_placeholder_stair(const coord_def &stair,
     stairs.push_back(placeholder);
 
     resize_stair_distances();
+    distances_dirty = true;
 }
 
 // If a stair leading out of or into a branch has a known destination, all
@@ -3367,9 +3550,9 @@ int LevelInfo::get_stair_index(const coord_def &pos) const
     return -1;
 }
 
-void LevelInfo::correct_stair_list(const vector<coord_def> &s)
+bool LevelInfo::correct_stair_list(const vector<coord_def> &s)
 {
-    stair_distances.clear();
+    bool changed = false;
 
     // Fix up the grid for the placeholder stair.
     for (stair_info &stair : stairs)
@@ -3392,7 +3575,10 @@ void LevelInfo::correct_stair_list(const vector<coord_def> &s)
         }
 
         if (!found)
+        {
             stairs.erase(stairs.begin() + i);
+            changed = true;
+        }
     }
 
     // For each stair in 's', make sure we have a corresponding stair
@@ -3428,12 +3614,20 @@ void LevelInfo::correct_stair_list(const vector<coord_def> &s)
             // that can't be helped. That information will have to be filled
             // in whenever the player takes these stairs.
             stairs.push_back(si);
+            changed = true;
         }
         else
             stairs[found].type = env.map_knowledge(pos).seen() ? stair_info::PHYSICAL : stair_info::MAPPED;
     }
 
-    resize_stair_distances();
+    // Stair indices shifted, so the old distance matrix is useless.
+    if (changed)
+    {
+        stair_distances.clear();
+        resize_stair_distances();
+    }
+
+    return changed;
 }
 
 void LevelInfo::resize_stair_distances()
@@ -3854,12 +4048,17 @@ void TravelCache::load(reader& inf, int minorVersion)
 
 void TravelCache::set_level_excludes()
 {
+    invalidate_travel_distance_cache();
     get_level_info(level_id::current()).set_level_excludes();
 }
 
 void TravelCache::update_excludes()
 {
-    get_level_info(level_id::current()).update_excludes();
+    invalidate_travel_distance_cache();
+    LevelInfo &li = get_level_info(level_id::current());
+    li.update_excludes();
+    // Excludes factor into stair-to-stair distances.
+    li.mark_stair_distances_dirty();
 }
 
 void TravelCache::update()
@@ -69,6 +69,9 @@ bool is_unknown_stair(const coord_def &p);
 void find_travel_pos(const coord_def& youpos, int *move_x, int *move_y,
                      vector<coord_def>* coords = nullptr);
 
+void invalidate_travel_distance_cache();
+void travel_stair_distances_dirty();
+
 bool is_stair_exclusion(const coord_def &p);
 
 /* ***********************************************************************
@@ -287,7 +290,8 @@ public:
 // Information on a level that interlevel travel needs.
 struct LevelInfo
 {
-    LevelInfo() : stairs(), excludes(), stair_distances(), id()
+    LevelInfo() : stairs(), excludes(), stair_distances(), id(),
+                  distances_dirty(true)
     {
         daction_counters.init(0);
     }
@@ -309,6 +313,13 @@ struct LevelInfo
     void clear_distances();
     void set_level_excludes();
 
+    // Force the stair distance matrix to be recomputed on the next
+    // update(); called when terrain or excludes change.
+    void mark_stair_distances_dirty()
+    {
+        distances_dirty = true;
+    }
+
     const exclude_set &get_excludes() const
     {
         return excludes;
@@ -340,7 +351,7 @@ private:
     // level.
     static void get_stairs(vector<coord_def> &stairs);
 
-    void correct_stair_list(const vector<coord_def> &s);
+    bool correct_stair_list(const vector<coord_def> &s);
     void update_stair_distances();
     void sync_all_branch_stairs();
     void sync_branch_stairs(const stair_info *si);
@@ -356,6 +367,9 @@ private:
     vector<short> stair_distances;  // Dist between stairs
     level_id id;
 
+    // True if stair_distances needs recomputing before use.
+    bool distances_dirty;
+
     friend class TravelCache;
 
 private:
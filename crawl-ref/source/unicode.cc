@@ -471,6 +471,30 @@ string UTF8FileLineInput::get_line()
     return utf8_validate(out.c_str());
 }
 
+// wcwidth() behind a flat memo table. Text measurement re-runs for
+// every message line and map glyph on every console redraw, and on
+// UNIX each wcwidth() call is a libc lookup; column widths never
+// change, so a byte per BMP codepoint answers nearly every query.
+// Astral-plane codepoints fall through to the real implementation.
+int char_width(ucs_t c)
+{
+    static int8_t memo[0x10000];
+    static bool initialised = false;
+
+    if (c >= 0x10000)
+        return wcwidth(c);
+
+    if (!initialised)
+    {
+        memset(memo, -2, sizeof(memo)); // wcwidth() returns -1..2
+        initialised = true;
+    }
+
+    if (memo[c] == -2)
+        memo[c] = wcwidth(c);
+    return memo[c];
+}
+
 int strwidth(const char *s)
 {
     ucs_t c;
@@ -479,7 +503,7 @@ int strwidth(const char *s)
     while (int l = utf8towc(&c, s))
     {
         s += l;
-        int cw = wcwidth(c);
+        int cw = char_width(c);
         if (cw != -1) // shouldn't ever happen
             w += cw;
     }
@@ -510,7 +534,7 @@ char *prev_glyph(char *s, char *start)
         while ((*s & 0xc0) == 0x80);
         // If a combining one, continue.
         utf8towc(&c, s);
-    } while (!wcwidth(c));
+    } while (!char_width(c));
     return s;
 }
 
@@ -527,7 +551,7 @@ char *next_glyph(char *s)
         s += utf8towc(&c, s_cur = s);
         // And any combining ones after it.
     }
-    while (c && !wcwidth(c));
+    while (c && !char_width(c));
     return s_cur;
 }
 
@@ -538,7 +562,7 @@ string chop_string(const char *s, int width, bool spaces)
 
     while (int clen = utf8towc(&c, s))
     {
-        int cw = wcwidth(c);
+        int cw = char_width(c);
         // Due to combining chars, we can't stop at merely reaching the
         // target width, the next character needs to exceed it.
         if (cw > width) // note: a CJK character might leave one space left
@@ -590,7 +614,7 @@ string chop_tagged_string(const char *s, int width, bool spaces)
 
         if (visible)
         {
-            const int cw = wcwidth(c);
+            const int cw = char_width(c);
             // Due to combining chars, we can't stop at merely reaching the
             // target width, the next character needs to exceed it.
             if (cw > width) // note: a CJK character might leave one space left
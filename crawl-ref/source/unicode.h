@@ -49,6 +49,8 @@ int wclen(ucs_t c);
 int wcwidth(ucs_t c);
 #endif
 
+int char_width(ucs_t c);
+
 char *prev_glyph(char *s, char *start);
 char *next_glyph(char *s);
 
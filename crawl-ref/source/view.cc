@@ -1388,8 +1388,16 @@ void viewwindow(bool show_updates, bool tiles_only, animation *a)
     if (show_updates)
         player_view_update();
 
-    bool run_dont_draw = you.running && Options.travel_delay < 0
-                && (!you.running.is_explore() || Options.explore_delay < 0);
+    // Which delay option governs the draw depends on what kind of run
+    // this is. Resting used to follow travel_delay here, so rest_delay's
+    // documented -1 behaviour never actually skipped the console draw:
+    // long rests redrew the whole view every turn for nothing.
+    bool run_dont_draw = you.running
+                && (you.running.is_rest()
+                    ? Options.rest_delay < 0
+                    : Options.travel_delay < 0
+                      && (!you.running.is_explore()
+                          || Options.explore_delay < 0));
 
     if (run_dont_draw || you.asleep())
     {
@@ -263,6 +263,18 @@ const crawl_view_buffer &crawl_view_buffer::operator = (const crawl_view_buffer
     return *this;
 }
 
+bool crawl_view_buffer::operator == (const crawl_view_buffer &rhs) const
+{
+    if (m_size != rhs.m_size)
+        return false;
+
+    const int count = m_size.x * m_size.y;
+    for (int i = 0; i < count; i++)
+        if (m_buffer[i] != rhs.m_buffer[i])
+            return false;
+    return true;
+}
+
 void crawl_view_buffer::clear()
 {
     delete [] m_buffer;
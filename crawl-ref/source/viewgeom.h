@@ -11,6 +11,20 @@ struct screen_cell_t
 #ifdef USE_TILE
     packed_cell tile;
 #endif
+
+    bool operator ==(const screen_cell_t &other) const
+    {
+        return glyph == other.glyph && colour == other.colour
+               && flash_colour == other.flash_colour
+#ifdef USE_TILE
+               && tile == other.tile
+#endif
+               ;
+    }
+    bool operator !=(const screen_cell_t &other) const
+    {
+        return !(*this == other);
+    }
 };
 
 class crawl_view_buffer
@@ -27,6 +41,7 @@ public:
     operator screen_cell_t * () { return m_buffer; }
     operator const screen_cell_t * () const { return m_buffer; }
     const crawl_view_buffer & operator = (const crawl_view_buffer &rhs);
+    bool operator == (const crawl_view_buffer &rhs) const;
 
     void clear();
     void draw();
@@ -307,6 +307,42 @@ static int _get_number_of_lines_levelmap()
 }
 
 #ifndef USE_TILE_LOCAL
+// The base glyph and colour of every cell, translated lazily and kept
+// for the whole map session: the level map is redrawn on each keystroke,
+// and get_cell_glyph() is by far the heaviest part of that. Only the
+// base translation is cached; travel colours, waypoints, the trail and
+// the player glyph are cheap per-cell overlays applied at draw time.
+static FixedArray<cglyph_t, GXM, GYM> _glyph_cache;
+static FixedArray<bool, GXM, GYM> _glyph_cache_valid;
+
+// Called whenever the map knowledge we translated may have changed:
+// entering the map or switching levels, and forgetting, restoring or
+// clearing the level map.
+static void _flush_glyph_cache()
+{
+    _glyph_cache_valid.init(false);
+}
+
+static cglyph_t _cached_glyph(const coord_def &c)
+{
+    if (_glyph_cache_valid(c))
+        return _glyph_cache(c);
+
+    cglyph_t g = get_cell_glyph(c, false, -1);
+
+    if (get_cell_show_class(env.map_knowledge(c)) == SH_NOTHING
+        && _is_explore_horizon(c))
+    {
+        const feature_def& fd = get_feature_def(DNGN_EXPLORE_HORIZON);
+        g.ch  = fd.symbol();
+        g.col = fd.colour();
+    }
+
+    _glyph_cache(c) = g;
+    _glyph_cache_valid(c) = true;
+    return g;
+}
+
 static void _draw_level_map(int start_x, int start_y, bool travel_mode,
         bool on_level)
 {
@@ -333,19 +369,10 @@ static void _draw_level_map(int start_x, int start_y, bool travel_mode,
             }
             else
             {
-                cglyph_t g = get_cell_glyph(c, false, -1);
+                const cglyph_t g = _cached_glyph(c);
                 cell->glyph = g.ch;
                 cell->colour = g.col;
 
-                const show_class show = get_cell_show_class(env.map_knowledge(c));
-
-                if (show == SH_NOTHING && _is_explore_horizon(c))
-                {
-                    const feature_def& fd = get_feature_def(DNGN_EXPLORE_HORIZON);
-                    cell->glyph = fd.symbol();
-                    cell->colour = fd.colour();
-                }
-
                 if (travel_mode && travel_colour_override(c))
                     cell->colour = _get_travel_colour(c);
 
@@ -683,6 +710,9 @@ bool show_map(level_pos &lpos,
 
             if (new_level)
             {
+#ifndef USE_TILE_LOCAL
+                _flush_glyph_cache();
+#endif
                 on_level = (level_id::current() == original);
 
                 move_x = 0, move_y = 0, scroll_y = 0;
@@ -866,6 +896,9 @@ bool show_map(level_pos &lpos,
 
             case CMD_MAP_CLEAR_MAP:
                 clear_map();
+#ifndef USE_TILE_LOCAL
+                _flush_glyph_cache();
+#endif
                 break;
 
             case CMD_MAP_FORGET:
@@ -876,6 +909,9 @@ bool show_map(level_pos &lpos,
                     MapKnowledge *old = new MapKnowledge(env.map_knowledge);
                     _forget_map();
                     env.map_forgotten.reset(old);
+#ifndef USE_TILE_LOCAL
+                    _flush_glyph_cache();
+#endif
                     mpr("Level map cleared.");
                 }
                 break;
@@ -885,6 +921,9 @@ bool show_map(level_pos &lpos,
                 {
                     _unforget_map();
                     env.map_forgotten.reset();
+#ifndef USE_TILE_LOCAL
+                    _flush_glyph_cache();
+#endif
                     mpr("Remembered map restored.");
                 }
                 else
@@ -82,7 +82,11 @@ class WebtilesSocketConnection(object):
             self.msg_buffer = None
 
             if self.message_callback:
-                self.message_callback(data)
+                # The game may batch several newline-terminated messages
+                # into one datagram; deliver them individually.
+                for line in data.split("\n"):
+                    if line:
+                        self.message_callback(line + "\n")
 
     def send_message(self, data):
         start = datetime.now()
@@ -100,6 +100,8 @@ class CrawlProcessHandlerBase(object):
 
         self.end_callback = None
         self._receivers = set()
+        self._client_html_version = None
+        self._client_html = None
         self.last_activity_time = time.time()
         self.idle_checker = PeriodicCallback(self.check_idle, 10000,
                                              io_loop = self.io_loop)
@@ -142,8 +144,11 @@ class CrawlProcessHandlerBase(object):
             receiver.write_message(msg, send)
 
     def send_to_all(self, msg, **data):
+        # Serialize once; every receiver gets an identical frame.
+        data["msg"] = msg
+        frame = json_encode(data)
         for receiver in self._receivers:
-            receiver.send_message(msg, **data)
+            receiver.write_message(frame)
 
     def handle_chat_message(self, username, text):
         chat_msg = ("<span class='chat_sender'>%s</span>: <span class='chat_msg'>%s</span>" %
@@ -243,11 +248,16 @@ class CrawlProcessHandlerBase(object):
         GameDataHandler.add_version(v,
                                     os.path.join(self.client_path, "static"))
 
-        templ_path = os.path.join(self.client_path, "templates")
-        loader = DynamicTemplateLoader.get(templ_path)
-        templ = loader.load("game.html")
-        game_html = templ.generate(version = v)
-        watcher.send_message("game_client", version = v, content = game_html)
+        # The rendered client page only depends on the version hash, so
+        # render it once instead of once per receiver.
+        if self._client_html_version != v:
+            templ_path = os.path.join(self.client_path, "templates")
+            loader = DynamicTemplateLoader.get(templ_path)
+            templ = loader.load("game.html")
+            self._client_html = templ.generate(version = v)
+            self._client_html_version = v
+        watcher.send_message("game_client", version = v,
+                             content = self._client_html)
 
     def stop(self):
         if self.process:
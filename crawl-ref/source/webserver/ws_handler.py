@@ -34,9 +34,12 @@ def update_global_status():
 
 def update_all_lobbys(game):
     lobby_entry = game.lobby_entry()
+    # Serialize once; every lobby socket gets an identical frame.
+    lobby_entry["msg"] = "lobby_entry"
+    msg = json_encode(lobby_entry)
     for socket in list(sockets):
         if socket.is_in_lobby():
-            socket.send_message("lobby_entry", **lobby_entry)
+            socket.write_message(msg)
 def remove_in_lobbys(process):
     for socket in list(sockets):
         if socket.is_in_lobby():
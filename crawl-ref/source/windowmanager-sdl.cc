@@ -820,6 +820,102 @@ void SDLWrapper::show_keyboard()
     SDL_StartTextInput(); // XXX: Intended for Android; harmless elsewhere?
 }
 
+// ======================================================================
+// Decoded-pixel cache.
+//
+// The tile sheets are decoded from PNG and converted to padded RGBA on
+// every startup. Cache the converted pixels in the versioned save
+// directory so later launches are a single read and a single upload.
+
+// Bump this whenever the cache format changes.
+#define PIXEL_CACHE_VERSION 1
+#define PIXEL_CACHE_MAGIC   0x54455843 // "TEXC"
+
+struct pixel_cache_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_mtime; // mtime of the PNG this was decoded from
+    uint32_t width, height;           // padded (power-of-two) extent
+    uint32_t orig_width, orig_height; // extent of the source image
+};
+
+static string _pixel_cache_path(const char *filename)
+{
+    return savedir_versioned_path(string(filename) + ".pix");
+}
+
+static unsigned char *_load_cached_pixels(const char *filename,
+                                          const string &tex_path,
+                                          unsigned int &width,
+                                          unsigned int &height,
+                                          unsigned int &orig_width,
+                                          unsigned int &orig_height)
+{
+    FILE *fp = fopen_u(_pixel_cache_path(filename).c_str(), "rb");
+    if (!fp)
+        return nullptr;
+
+    pixel_cache_header hdr;
+    if (fread(&hdr, sizeof(hdr), 1, fp) != 1
+        || hdr.magic != PIXEL_CACHE_MAGIC
+        || hdr.version != PIXEL_CACHE_VERSION
+        || hdr.source_mtime != (uint32_t)file_modtime(tex_path)
+        || !hdr.width || !hdr.height)
+    {
+        fclose(fp);
+        return nullptr;
+    }
+
+    const size_t sz = 4 * hdr.width * hdr.height;
+    unsigned char *pixels = new unsigned char[sz];
+    if (fread(pixels, 1, sz, fp) != sz)
+    {
+        delete[] pixels;
+        fclose(fp);
+        return nullptr;
+    }
+    fclose(fp);
+
+    width       = hdr.width;
+    height      = hdr.height;
+    orig_width  = hdr.orig_width;
+    orig_height = hdr.orig_height;
+    return pixels;
+}
+
+static void _save_cached_pixels(const char *filename, const string &tex_path,
+                                const unsigned char *pixels,
+                                unsigned int width, unsigned int height,
+                                unsigned int orig_width,
+                                unsigned int orig_height)
+{
+    const string path = _pixel_cache_path(filename);
+    const string tmp  = path + ".tmp";
+    FILE *fp = fopen_u(tmp.c_str(), "wb");
+    if (!fp)
+        return;
+
+    pixel_cache_header hdr;
+    hdr.magic        = PIXEL_CACHE_MAGIC;
+    hdr.version      = PIXEL_CACHE_VERSION;
+    hdr.source_mtime = (uint32_t)file_modtime(tex_path);
+    hdr.width        = width;
+    hdr.height       = height;
+    hdr.orig_width   = orig_width;
+    hdr.orig_height  = orig_height;
+
+    const size_t sz = 4 * width * height;
+    const bool ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1
+                    && fwrite(pixels, 1, sz, fp) == sz;
+    fclose(fp);
+
+    if (ok)
+        rename_u(tmp.c_str(), path.c_str());
+    else
+        unlink_u(tmp.c_str());
+}
+
 bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
                               MipMapOptions mip_opt, unsigned int &orig_width,
                               unsigned int &orig_height, tex_proc_func proc,
@@ -839,6 +935,24 @@ bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
         return false;
     }
 
+    // A caller-supplied proc may transform the pixels, so only cache
+    // plain loads.
+    if (!proc)
+    {
+        unsigned int cw, ch;
+        unsigned char *cached = _load_cached_pixels(filename, tex_path,
+                                                    cw, ch,
+                                                    orig_width, orig_height);
+        if (cached)
+        {
+            glmanager->pixelstore_unpack_alignment(4);
+            const bool success = tex->load_texture(cached, cw, ch, mip_opt);
+            delete[] cached;
+            if (success)
+                return true;
+        }
+    }
+
     SDL_Surface *img = load_image(tex_path.c_str());
 
     if (!img)
@@ -991,6 +1105,15 @@ bool SDLWrapper::load_texture(GenericTexture *tex, const char *filename,
     if (!proc || proc(pixels, new_width, new_height))
         success |= tex->load_texture(pixels, new_width, new_height, mip_opt);
 
+    // If conversion has occurred, the buffer is dense RGBA; cache it
+    // for the next launch. (The unconverted paths keep the surface's
+    // own pixel format, which the cache doesn't describe.)
+    if (success && !proc && pixels != img->pixels)
+    {
+        _save_cached_pixels(filename, tex_path, pixels,
+                            new_width, new_height, img->w, img->h);
+    }
+
     // If conversion has occurred, delete converted data.
     if (pixels != img->pixels)
         delete[] pixels;
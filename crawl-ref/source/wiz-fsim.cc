@@ -356,6 +356,14 @@ static fight_data _get_fight_data(monster &mon, int iter_limit, bool defend)
     no_messages mx;
     const int hunger = you.hunger;
 
+    // Run the simulation on its own deterministically seeded random number
+    // stream: identical setups then produce identical statistics, which
+    // makes before/after comparisons meaningful when tuning, and a long
+    // simulation doesn't perturb the game's randomness. The seed folds in
+    // the matchup so attack and defense runs aren't correlated.
+    push_rng_state();
+    seed_rng(uint32_t(mon.type) * 2654435761u + iter_limit * 2 + defend);
+
     const coord_def start_pos = mon.pos();
     const coord_def you_start_pos = you.pos();
 
@@ -370,7 +378,8 @@ static fight_data _get_fight_data(monster &mon, int iter_limit, bool defend)
             // Re-place the combatants if they e.g. blinked away or were
             // trampled.
             mon.move_to_pos(start_pos);
-            you.move_to_pos(you_start_pos);
+            if (you.pos() != you_start_pos)
+                you.move_to_pos(you_start_pos);
             mon.hit_points = mon.max_hit_points;
             mon.shield_blocks = 0;
             you.time_taken = player_speed();
@@ -424,13 +433,17 @@ static fight_data _get_fight_data(monster &mon, int iter_limit, bool defend)
 
             // Re-place the combatants if they e.g. blinked away or were
             // trampled.
-            mon.move_to_pos(start_pos);
-            you.move_to_pos(you_start_pos);
+            if (mon.pos() != start_pos)
+                mon.move_to_pos(start_pos);
+            if (you.pos() != you_start_pos)
+                you.move_to_pos(you_start_pos);
         }
         you.hp = yhp;
         you.hp_max = ymhp;
     }
 
+    pop_rng_state();
+
     fdata.av_hit_dam = hits ? double(cumulative_damage) / hits : 0.0;
     fdata.accuracy = 100 * hits / iter_limit;
     fdata.av_dam = double(cumulative_damage) / iter_limit;
@@ -167,6 +167,7 @@ void wizard_change_species_to(species_type sp)
         }
         prev_muts[i] = you.mutation[i];
     }
+    invalidate_mutation_cache();
     give_basic_mutations(sp);
     for (int i = 2; i <= you.experience_level; ++i)
         give_level_mutations(sp, i);
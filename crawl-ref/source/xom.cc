@@ -2960,6 +2960,43 @@ static void _handle_accidental_death(const int orig_hp,
  * @param tension       How much danger we think the player's currently in.
  * @return              A good action for Xom to take, e.g. XOM_GOOD_ALLIES.
  */
+// Candidate facts probed while choosing a Xom action. A single
+// selection retries _xom_choose_good_action()/_xom_choose_bad_action()
+// until a roll sticks, and only the dice change between retries, so
+// each fact is evaluated at most once per xom_choose_action() call and
+// remembered here. -1 means not yet checked.
+struct xom_selection_cache
+{
+    void reset()
+    {
+        hostile = enchantable = snake = animateable = poly_target = -1;
+        scenery = blink_victim = chaos_upgrade = swap_pieces = -1;
+        stairs = explored_mapped = explored_seen = -1;
+    }
+
+    int hostile, enchantable, snake, animateable, poly_target;
+    int scenery, blink_victim, chaos_upgrade, swap_pieces;
+    int stairs, explored_mapped, explored_seen;
+};
+
+static xom_selection_cache _xom_sel;
+
+static bool _sel_memo(int &slot, bool (*check)())
+{
+    if (slot == -1)
+        slot = check() ? 1 : 0;
+    return slot;
+}
+
+static int _sel_exploration_estimate(bool seen_only)
+{
+    int &slot = seen_only ? _xom_sel.explored_seen
+                          : _xom_sel.explored_mapped;
+    if (slot == -1)
+        slot = _exploration_estimate(seen_only);
+    return slot;
+}
+
 static xom_event_type _xom_choose_good_action(int sever, int tension)
 {
     // This series of random calls produces a poisson-looking
@@ -2984,7 +3021,7 @@ static xom_event_type _xom_choose_good_action(int sever, int tension)
         // Only do mmap/detect items if there's a decent chunk of unexplored
         }
         // level left
-        const int explored = _exploration_estimate(false);
+        const int explored = _sel_exploration_estimate(false);
         if (explored <= 80 || x_chance_in_y(explored, 100))
             return divination;
     }
@@ -3002,13 +3039,18 @@ static xom_event_type _xom_choose_good_action(int sever, int tension)
     }
 
     if (tension > 0 && x_chance_in_y(5, sever)
-        && mon_nearby([](monster* mon){ return !mon->wont_attack(); }))
+        && _sel_memo(_xom_sel.hostile, []()
+           {
+               return mon_nearby([](monster* mon)
+                                 { return !mon->wont_attack(); });
+           }))
     {
         return XOM_GOOD_CONFUSION;
     }
 
     if (tension > 0 && x_chance_in_y(6, sever)
-        && mon_nearby(_choose_enchantable_monster))
+        && _sel_memo(_xom_sel.enchantable,
+                     []() { return mon_nearby(_choose_enchantable_monster); }))
     {
         return XOM_GOOD_ENCHANT_MONSTER;
     }
@@ -3019,12 +3061,16 @@ static xom_event_type _xom_choose_good_action(int sever, int tension)
         return XOM_GOOD_SINGLE_ALLY;
     }
     if (tension < random2(5) && x_chance_in_y(8, sever)
-        && !_xom_scenery_candidates().empty() || one_chance_in(8))
+        && _sel_memo(_xom_sel.scenery,
+                     []() { return !_xom_scenery_candidates().empty(); })
+        || one_chance_in(8))
     {
         return XOM_GOOD_SCENERY;
     }
 
-    if (x_chance_in_y(9, sever) && mon_nearby(_hostile_snake))
+    if (x_chance_in_y(9, sever)
+        && _sel_memo(_xom_sel.snake,
+                     []() { return mon_nearby(_hostile_snake); }))
         return XOM_GOOD_SNAKES;
 
     if (tension > random2(10) && x_chance_in_y(10, sever)
@@ -3033,13 +3079,20 @@ static xom_event_type _xom_choose_good_action(int sever, int tension)
         return XOM_GOOD_ALLIES;
     }
     if (tension > random2(8) && x_chance_in_y(11, sever)
-        && _find_monster_with_animateable_weapon()
+        && _sel_memo(_xom_sel.animateable,
+                     []()
+                     {
+                         return _find_monster_with_animateable_weapon()
+                                != nullptr;
+                     })
         && !player_mutation_level(MUT_NO_LOVE))
     {
         return XOM_GOOD_ANIMATE_MON_WPN;
     }
 
-    if (x_chance_in_y(12, sever) && _xom_mons_poly_target() != nullptr)
+    if (x_chance_in_y(12, sever)
+        && _sel_memo(_xom_sel.poly_target,
+                     []() { return _xom_mons_poly_target() != nullptr; }))
         return XOM_GOOD_POLYMORPH;
 
     if (tension > 0 && x_chance_in_y(13, sever))
@@ -3083,7 +3136,7 @@ static xom_event_type _xom_choose_good_action(int sever, int tension)
         // This is not very interesting if the level is already fully
         // explored (presumably cleared). Even then, it may
         // occasionally happen.
-        const int explored = _exploration_estimate(true);
+        const int explored = _sel_exploration_estimate(true);
         if (explored < 80 || !x_chance_in_y(explored, 120))
             return XOM_GOOD_TELEPORT;
     }
@@ -3139,7 +3192,8 @@ static xom_event_type _xom_choose_bad_action(int sever, int tension)
         return XOM_BAD_ENCHANT_MONSTER;
 
     if (tension > 0 && x_chance_in_y(8, sever)
-        && mon_nearby(_mon_valid_blink_victim))
+        && _sel_memo(_xom_sel.blink_victim,
+                     []() { return mon_nearby(_mon_valid_blink_victim); }))
     {
         return XOM_BAD_BLINK_MONSTERS;
     }
@@ -3149,19 +3203,22 @@ static xom_event_type _xom_choose_bad_action(int sever, int tension)
         return XOM_BAD_CONFUSION;
 
     if (tension > 0 && x_chance_in_y(10, sever)
-        && _rearrangeable_pieces().size())
+        && _sel_memo(_xom_sel.swap_pieces,
+                     []() { return !_rearrangeable_pieces().empty(); }))
     {
         return XOM_BAD_SWAP_MONSTERS;
     }
 
     if (x_chance_in_y(12, sever))
         return XOM_BAD_MISCAST_MAJOR;
-    if (x_chance_in_y(14, sever) && mon_nearby(_choose_chaos_upgrade))
+    if (x_chance_in_y(14, sever)
+        && _sel_memo(_xom_sel.chaos_upgrade,
+                     []() { return mon_nearby(_choose_chaos_upgrade); }))
         return XOM_BAD_CHAOS_UPGRADE;
     if (x_chance_in_y(15, sever) && !player_in_branch(BRANCH_ABYSS)
         && _teleportation_check())
     {
-        const int explored = _exploration_estimate(true);
+        const int explored = _sel_exploration_estimate(true);
         if (nasty && (explored >= 40 || tension > 10)
             || explored >= 60 + random2(40))
         {
@@ -3174,7 +3231,9 @@ static xom_event_type _xom_choose_bad_action(int sever, int tension)
         return XOM_BAD_POLYMORPH;
  // Pushing stairs/exits is always hilarious in the Abyss!
     if ((tension > 0 || player_in_branch(BRANCH_ABYSS))
-        && x_chance_in_y(17, sever) && !_nearby_stairs().empty()
+        && x_chance_in_y(17, sever)
+        && _sel_memo(_xom_sel.stairs,
+                     []() { return !_nearby_stairs().empty(); })
         && !you.duration[DUR_REPEL_STAIRS_MOVE]
         && !you.duration[DUR_REPEL_STAIRS_CLIMB])
     {
@@ -3235,6 +3294,10 @@ xom_event_type xom_choose_action(bool niceness, int sever, int tension)
 {
     sever = max(1, sever);
 
+    // The world doesn't change while we're rerolling candidate actions
+    // below, so start each selection with a clean fact cache.
+    _xom_sel.reset();
+
     if (_player_is_dead())
     {
         // This should only happen if the player used wizard mode to